@@ -0,0 +1,29 @@
+#include "ofMain.h"
+#include "ofApp.h"
+#include "ofAppNoWindow.h"
+
+//========================================================================
+// Usage : example-benchmark [--frames N] [--warmup N] [--only workloadName] [--out path/to/results.json]
+int main( int argc, char** argv ){
+	ofSetLogLevel(OF_LOG_WARNING);
+
+	ofApp::BenchmarkOptions options;
+	for(int i = 1; i < argc; ++i){
+		std::string arg = argv[i];
+		bool hasValue = i + 1 < argc;
+		if(arg == "--frames" && hasValue) options.frames = std::max(1, ofToInt(argv[++i]));
+		else if(arg == "--warmup" && hasValue) options.warmupFrames = std::max(0, ofToInt(argv[++i]));
+		else if(arg == "--only" && hasValue) options.only = argv[++i];
+		else if(arg == "--out" && hasValue) options.outputPath = argv[++i];
+	}
+
+	// Count ImGui allocations. Needs to be set before any ImGui context is created.
+	ofxImGui::AllocationTracker::install();
+
+	// Headless : no GL context, ofxImGui uses its null backend (see ofximguiconfig.h)
+	auto window = std::make_shared<ofAppNoWindow>();
+	auto app = std::make_shared<ofApp>(options);
+
+	ofRunApp(window, app);
+	return ofRunMainLoop();
+}
@@ -0,0 +1,425 @@
+#include "ofApp.h"
+#include "ofAppNoWindow.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+
+// Fills a group recursively : depth levels, 2 sub-groups per level
+static void fillGroup(ofParameterGroup& group, int depth){
+    for(int i = 0; i < 5; ++i){
+        ofParameter<float> param;
+        group.add(param.set("float " + ofToString(i), 0.5f, 0.f, 1.f));
+    }
+    ofParameter<int> intParam;
+    ofParameter<bool> boolParam;
+    ofParameter<ofFloatColor> colorParam;
+    group.add(intParam.set("int", 5, 0, 10));
+    group.add(boolParam.set("bool", true));
+    group.add(colorParam.set("color", ofFloatColor(1, 0.5, 0.25, 1)));
+
+    if(depth <= 1) return;
+    for(int i = 0; i < 2; ++i){
+        ofParameterGroup child;
+        child.setName("Level " + ofToString(depth - 1) + " #" + ofToString(i));
+        fillGroup(child, depth - 1);
+        group.add(child);
+    }
+}
+
+//--------------------------------------------------------------
+ofxImGui::AllocationTracker::Counters ofApp::getAllocationTotals() const {
+    // Allocations outside of frames, and in all phases of all contexts
+    ofxImGui::AllocationTracker::Counters totals = ofxImGui::AllocationTracker::getUntrackedCounters();
+    auto addContext = [&totals](const ofxImGui::Gui& contextGui){
+        for(int phase = 0; phase < ofxImGui::FrameProfiler::NumPhases; ++phase){
+            ofxImGui::AllocationTracker::Counters counters = contextGui.getProfiler()->getAllocations().getTotalCounters(phase);
+            totals.allocs += counters.allocs;
+            totals.bytes += counters.bytes;
+        }
+    };
+    addContext(gui);
+    for(auto& extraGui : extraGuis) addContext(*extraGui);
+    return totals;
+}
+
+//--------------------------------------------------------------
+void ofApp::setup() {
+    // Main context, manual draw
+    gui.setup(nullptr, false);
+
+    // Extra contexts, each bound to its own (headless) window
+    ofWindowSettings windowSettings;
+    windowSettings.setSize(1024, 768);
+    for(int i = 0; i < 4; ++i){
+        auto window = std::make_shared<ofAppNoWindow>();
+        window->setup(windowSettings);
+        extraWindows.push_back(window);
+        extraGuis.emplace_back(new ofxImGui::Gui());
+        extraGuis.back()->setup(extraWindows.back(), nullptr, false);
+    }
+    scheduler.setup();
+
+    // Workload data
+    deepGroup.setName("Deep group");
+    fillGroup(deepGroup, 7);
+
+    flatGroup.setName("Flat group");
+    for(int i = 0; i < 10000; ++i){
+        ofParameter<float> param;
+        flatGroup.add(param.set("param " + ofToString(i % 100), 0.5f, 0.f, 1.f));
+    }
+
+    largeValues.resize(10000);
+    for(std::size_t i = 0; i < largeValues.size(); ++i){
+        largeValues[i] = glm::vec3(ofRandomuf(), ofRandomuf(), ofRandomuf());
+    }
+
+    // Sensor-like stream
+    timeSeries.reserve(10000000);
+    for(int i = 0; i < 10000000; ++i){
+        timeSeries.append(std::sin(i * 0.0001f) + ofRandomf() * 0.1f);
+    }
+
+    for(int i = 0; i < 100000; ++i){
+        longPolyline.addVertex(i * 0.01f, std::sin(i * 0.002f) * 100.f + ofRandomf() * 5.f);
+    }
+
+    // Long log, drained regularly so the ring never overflows
+    ofxImGui::LoggerChannel::setMemoryCap(64 * 1024 * 1024);
+    for(int i = 0; i < 200000; ++i){
+        logger.log(i % 10 == 0 ? OF_LOG_WARNING : OF_LOG_NOTICE, i % 3 == 0 ? "moduleA" : "moduleB", "Benchmark message %d, with some payload to make it longer than a few words.", i);
+        if(i % 1000 == 0) ofxImGui::LoggerChannel::drain();
+    }
+    ofxImGui::LoggerChannel::drain();
+}
+
+//--------------------------------------------------------------
+void ofApp::update(){
+    if(hasRun) return;
+    hasRun = true;
+
+    if(shouldRun("windows_1k")) runWorkload("windows_1k", [this](int frame){ buildManyWindows(frame, 1000); });
+    if(shouldRun("table_100k_rows")) runWorkload("table_100k_rows", [this](int frame){ buildBigTable(frame); });
+    if(shouldRun("addgroup_deep")) runWorkload("addgroup_deep", [this](int frame){ buildDeepGroup(frame); });
+    if(shouldRun("addgroup_10k_params")) runWorkload("addgroup_10k_params", [this](int frame){ buildFlatGroup(frame); });
+    if(shouldRun("clippedgroup_10k_params")) runWorkload("clippedgroup_10k_params", [this](int frame){ buildClippedGroup(frame); });
+    if(shouldRun("searchgroup_10k_params")) runWorkload("searchgroup_10k_params", [this](int frame){ buildSearchableGroup(frame); });
+    if(shouldRun("addvalues_10k")) runWorkload("addvalues_10k", [this](int frame){ buildLargeValues(frame); });
+    if(shouldRun("valueseditor_10k")) runWorkload("valueseditor_10k", [this](int frame){ buildValuesEditor(frame); });
+    if(shouldRun("timeseries_10m")) runWorkload("timeseries_10m", [this](int frame){ buildTimeSeries(frame); });
+    if(shouldRun("shapes_100k_polyline")) runWorkload("shapes_100k_polyline", [this](int frame){ buildShapes(frame); });
+    if(shouldRun("logger_200k")) runWorkload("logger_200k", [this](int frame){ buildLogViewer(frame); });
+    if(shouldRun("multi_context")) runMultiContextWorkload("multi_context", [this](int frame){ buildManyWindows(frame, 100); });
+
+    // Report
+    std::string json = getJson();
+    std::cout << json << std::endl;
+    std::ofstream file(ofToDataPath(options.outputPath, true));
+    if(file){
+        file << json;
+    }
+    else {
+        ofLogError("ofApp::update()") << "Couldn't write " << options.outputPath;
+    }
+
+    ofExit(0);
+}
+
+//--------------------------------------------------------------
+void ofApp::exit(){
+    scheduler.exit();
+    for(auto& extraGui : extraGuis) extraGui->exit();
+    gui.exit();
+}
+
+//--------------------------------------------------------------
+bool ofApp::shouldRun(const std::string& name) const {
+    return options.only.empty() || options.only == name;
+}
+
+//--------------------------------------------------------------
+void ofApp::addDrawCounts(DrawCounts& counts){
+    ImDrawData* drawData = ImGui::GetDrawData();
+    if(drawData == nullptr || !drawData->Valid) return;
+    counts.vtx += drawData->TotalVtxCount;
+    counts.idx += drawData->TotalIdxCount;
+    counts.drawLists += drawData->CmdListsCount;
+    for(ImDrawList* list : drawData->CmdLists) counts.drawCmds += list->CmdBuffer.Size;
+}
+
+//--------------------------------------------------------------
+void ofApp::runWorkload(const std::string& name, std::function<void(int frame)> buildFunc){
+    WorkloadResult result;
+    result.name = name;
+    result.frameMs.reserve(options.frames);
+
+    const int totalFrames = options.warmupFrames + options.frames;
+    ofxImGui::AllocationTracker::Counters start;
+    for(int frame = 0; frame < totalFrames; ++frame){
+        if(frame == options.warmupFrames){
+            gui.getProfiler()->reset();
+            start = getAllocationTotals();
+        }
+
+        auto frameStart = std::chrono::steady_clock::now();
+        gui.begin();
+        buildFunc(frame);
+        gui.end();
+        gui.draw();
+        float ms = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - frameStart).count();
+
+        if(frame >= options.warmupFrames){
+            result.frameMs.push_back(ms);
+            if(frame == totalFrames - 1) addDrawCounts(result.counts);
+        }
+    }
+
+    ofxImGui::AllocationTracker::Counters end = getAllocationTotals();
+    result.allocsPerFrame = double(end.allocs - start.allocs) / options.frames;
+    result.bytesPerFrame = double(end.bytes - start.bytes) / options.frames;
+    for(int phase = 0; phase < ofxImGui::FrameProfiler::NumPhases; ++phase){
+        result.phaseAvgMs[phase] = gui.getProfilerStats((ofxImGui::FrameProfiler::Phase)phase).avg;
+        result.phaseAllocsPerFrame[phase] = double(gui.getProfiler()->getAllocations().getTotalCounters(phase).allocs) / options.frames;
+    }
+    results.push_back(result);
+}
+
+//--------------------------------------------------------------
+void ofApp::runMultiContextWorkload(const std::string& name, std::function<void(int frame)> buildFunc){
+    WorkloadResult result;
+    result.name = name;
+    result.contexts = extraGuis.size();
+    result.frameMs.reserve(options.frames);
+
+    const int totalFrames = options.warmupFrames + options.frames;
+    ofxImGui::AllocationTracker::Counters start;
+    for(int frame = 0; frame < totalFrames; ++frame){
+        if(frame == options.warmupFrames){
+            start = getAllocationTotals();
+        }
+
+        auto frameStart = std::chrono::steady_clock::now();
+        for(auto& extraGui : extraGuis){
+            scheduler.addFrame(*extraGui, [&buildFunc, frame](){ buildFunc(frame); });
+        }
+        scheduler.buildFrames();
+        DrawCounts counts;
+        for(auto& extraGui : extraGuis){
+            extraGui->draw();
+            if(frame == totalFrames - 1) addDrawCounts(counts);
+        }
+        float ms = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - frameStart).count();
+
+        if(frame >= options.warmupFrames){
+            result.frameMs.push_back(ms);
+            if(frame == totalFrames - 1) result.counts = counts;
+        }
+    }
+
+    ofxImGui::AllocationTracker::Counters end = getAllocationTotals();
+    result.allocsPerFrame = double(end.allocs - start.allocs) / options.frames;
+    result.bytesPerFrame = double(end.bytes - start.bytes) / options.frames;
+    results.push_back(result);
+}
+
+//--------------------------------------------------------------
+void ofApp::buildManyWindows(int frame, int numWindows){
+    char title[32];
+    for(int i = 0; i < numWindows; ++i){
+        snprintf(title, sizeof(title), "Window %d", i);
+        ImGui::SetNextWindowPos(ImVec2((i % 40) * 25.f, (i / 40) * 25.f), ImGuiCond_Always);
+        ImGui::SetNextWindowSize(ImVec2(200, 100), ImGuiCond_Always);
+        ImGui::Begin(title);
+        ImGui::Text("Frame %d", frame);
+        ImGui::Button("Button");
+        ImGui::SliderFloat("Slider", &sliderValues[i % 1000], 0.f, 1.f);
+        ImGui::End();
+    }
+}
+
+//--------------------------------------------------------------
+void ofApp::buildBigTable(int frame){
+    const int numRows = 100000;
+    ImGui::SetNextWindowPos(ImVec2(0, 0), ImGuiCond_Always);
+    ImGui::SetNextWindowSize(ImGui::GetIO().DisplaySize, ImGuiCond_Always);
+    ImGui::Begin("Table");
+    if(ImGui::BeginTable("##bigTable", 4, ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders)){
+        ImGui::TableSetupScrollFreeze(0, 1);
+        ImGui::TableSetupColumn("Index");
+        ImGui::TableSetupColumn("Name");
+        ImGui::TableSetupColumn("Value");
+        ImGui::TableSetupColumn("Hex");
+        ImGui::TableHeadersRow();
+
+        // Scroll through the table, so different rows are visible each frame
+        ImGui::SetScrollY(std::fmod(frame * 997.f, numRows * ImGui::GetTextLineHeightWithSpacing()));
+
+        ImGuiListClipper clipper;
+        clipper.Begin(numRows);
+        while(clipper.Step()){
+            for(int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row){
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn(); ImGui::Text("%d", row);
+                ImGui::TableNextColumn(); ImGui::Text("Row %d", row);
+                ImGui::TableNextColumn(); ImGui::Text("%.3f", row * 0.001f);
+                ImGui::TableNextColumn(); ImGui::Text("0x%08X", row);
+            }
+        }
+        ImGui::EndTable();
+    }
+    ImGui::End();
+}
+
+//--------------------------------------------------------------
+void ofApp::buildDeepGroup(int frame){
+    (void)frame;
+    ofxImGui::Settings settings;
+    settings.windowPos = ofVec2f(0, 0);
+    settings.windowSize = ofVec2f(ImGui::GetIO().DisplaySize.x, ImGui::GetIO().DisplaySize.y);
+    ofxImGui::AddGroup(deepGroup, settings);
+}
+
+//--------------------------------------------------------------
+void ofApp::buildFlatGroup(int frame){
+    (void)frame;
+    ofxImGui::Settings settings;
+    settings.windowPos = ofVec2f(0, 0);
+    settings.windowSize = ofVec2f(ImGui::GetIO().DisplaySize.x, ImGui::GetIO().DisplaySize.y);
+    ofxImGui::AddGroup(flatGroup, settings);
+}
+
+//--------------------------------------------------------------
+void ofApp::buildClippedGroup(int frame){
+    (void)frame;
+    ofxImGui::Settings settings;
+    settings.windowPos = ofVec2f(0, 0);
+    settings.windowSize = ofVec2f(ImGui::GetIO().DisplaySize.x, ImGui::GetIO().DisplaySize.y);
+    clippedGroup.draw(flatGroup, settings);
+}
+
+//--------------------------------------------------------------
+void ofApp::buildSearchableGroup(int frame){
+    ofxImGui::Settings settings;
+    settings.windowPos = ofVec2f(0, 0);
+    settings.windowSize = ofVec2f(ImGui::GetIO().DisplaySize.x, ImGui::GetIO().DisplaySize.y);
+    // New query each frame : measures the search, not only the drawing
+    searchableGroup.setFilter(frame % 2 == 0 ? "param 42" : "param 7");
+    searchableGroup.draw(flatGroup, settings);
+}
+
+//--------------------------------------------------------------
+void ofApp::buildLargeValues(int frame){
+    (void)frame;
+    ImGui::SetNextWindowPos(ImVec2(0, 0), ImGuiCond_Always);
+    ImGui::SetNextWindowSize(ImGui::GetIO().DisplaySize, ImGuiCond_Always);
+    ImGui::Begin("Values");
+    ofxImGui::AddValues("value", largeValues, 0.f, 1.f);
+    ImGui::End();
+}
+
+//--------------------------------------------------------------
+void ofApp::buildValuesEditor(int frame){
+    (void)frame;
+    ImGui::SetNextWindowPos(ImVec2(0, 0), ImGuiCond_Always);
+    ImGui::SetNextWindowSize(ImGui::GetIO().DisplaySize, ImGuiCond_Always);
+    ImGui::Begin("Values editor");
+    valuesEditor.draw("value", largeValues, 0.f, 1.f);
+    ImGui::End();
+}
+
+//--------------------------------------------------------------
+void ofApp::buildTimeSeries(int frame){
+    ImGui::SetNextWindowPos(ImVec2(0, 0), ImGuiCond_Always);
+    ImGui::SetNextWindowSize(ImGui::GetIO().DisplaySize, ImGuiCond_Always);
+    ImGui::Begin("Time series");
+    // Zooms from all samples to a few thousands, through every pyramid level
+    timeSeriesView.follow = false;
+    timeSeriesView.length = timeSeries.size() / std::pow(1.2, frame % 50);
+    timeSeriesView.start = (timeSeries.size() - timeSeriesView.length) * 0.5;
+    ofxImGui::PlotTimeSeries("Samples", timeSeries, timeSeriesView, ImVec2(-1, 300));
+    ImGui::End();
+}
+
+//--------------------------------------------------------------
+void ofApp::buildShapes(int frame){
+    ImGui::SetNextWindowPos(ImVec2(0, 0), ImGuiCond_Always);
+    ImGui::SetNextWindowSize(ImGui::GetIO().DisplaySize, ImGuiCond_Always);
+    ImGui::Begin("Shapes");
+    // 1000 units wide polyline, zooming from the whole curve to a few thousands points
+    const ImVec2 origin = ImGui::GetCursorScreenPos();
+    const float zoom = 0.8f * std::pow(1.1f, (float)(frame % 30));
+    ofxImGui::AddPolyline(ImGui::GetWindowDrawList(), longPolyline, IM_COL32_WHITE, 1.0f, ofxImGui::DrawTransform(ImVec2(origin.x, origin.y + 150), ImVec2(zoom, 1)));
+    ImGui::End();
+}
+
+//--------------------------------------------------------------
+void ofApp::buildLogViewer(int frame){
+    // Keep the log growing
+    for(int i = 0; i < 100; ++i){
+        logger.log(OF_LOG_NOTICE, "moduleC", "Frame %d message %d", frame, i);
+    }
+    ImGui::SetNextWindowPos(ImVec2(0, 0), ImGuiCond_Always);
+    ImGui::SetNextWindowSize(ImGui::GetIO().DisplaySize, ImGuiCond_Always);
+    logViewer.draw("Logs");
+}
+
+//--------------------------------------------------------------
+std::string ofApp::getJson() const {
+    std::ostringstream json;
+    json << "{\n";
+    json << "  \"imgui_version\": \"" << IMGUI_VERSION << "\",\n";
+    json << "  \"backend\": \"" << OFXIMGUI_LOADED_BACKEND << "\",\n";
+#ifdef OFXIMGUI_ENABLE_THREADED_CONTEXTS
+    json << "  \"threaded_contexts\": true,\n";
+#else
+    json << "  \"threaded_contexts\": false,\n";
+#endif
+    json << "  \"frames\": " << options.frames << ",\n";
+    json << "  \"warmup_frames\": " << options.warmupFrames << ",\n";
+    json << "  \"workloads\": [";
+    for(std::size_t r = 0; r < results.size(); ++r){
+        const WorkloadResult& result = results[r];
+        std::vector<float> sorted = result.frameMs;
+        std::sort(sorted.begin(), sorted.end());
+        float sum = 0;
+        for(float ms : sorted) sum += ms;
+        auto percentile = [&sorted](float p){
+            if(sorted.empty()) return 0.f;
+            std::size_t i = std::min(sorted.size() - 1, std::size_t(p * sorted.size()));
+            return sorted[i];
+        };
+
+        json << (r ? ",\n" : "\n");
+        json << "    {\n";
+        json << "      \"name\": \"" << result.name << "\",\n";
+        json << "      \"contexts\": " << result.contexts << ",\n";
+        json << "      \"cpu_ms\": { ";
+        json << "\"min\": " << (sorted.empty() ? 0.f : sorted.front()) << ", ";
+        json << "\"avg\": " << (sorted.empty() ? 0.f : sum / sorted.size()) << ", ";
+        json << "\"p50\": " << percentile(0.5f) << ", ";
+        json << "\"p99\": " << percentile(0.99f) << ", ";
+        json << "\"max\": " << (sorted.empty() ? 0.f : sorted.back()) << " },\n";
+        json << "      \"allocs_per_frame\": " << result.allocsPerFrame << ",\n";
+        json << "      \"alloc_bytes_per_frame\": " << result.bytesPerFrame << ",\n";
+        json << "      \"vtx_count\": " << result.counts.vtx << ",\n";
+        json << "      \"idx_count\": " << result.counts.idx << ",\n";
+        json << "      \"draw_lists\": " << result.counts.drawLists << ",\n";
+        json << "      \"draw_cmds\": " << result.counts.drawCmds << ",\n";
+        json << "      \"phases_avg_ms\": {";
+        for(int phase = 0; phase < ofxImGui::FrameProfiler::NumPhases; ++phase){
+            json << (phase ? ", " : " ") << "\"" << ofxImGui::FrameProfiler::getPhaseName((ofxImGui::FrameProfiler::Phase)phase) << "\": " << result.phaseAvgMs[phase];
+        }
+        json << " },\n";
+        json << "      \"phases_allocs_per_frame\": {";
+        for(int phase = 0; phase < ofxImGui::FrameProfiler::NumPhases; ++phase){
+            json << (phase ? ", " : " ") << "\"" << ofxImGui::FrameProfiler::getPhaseName((ofxImGui::FrameProfiler::Phase)phase) << "\": " << result.phaseAllocsPerFrame[phase];
+        }
+        json << " }\n";
+        json << "    }";
+    }
+    json << "\n  ]\n}";
+    return json.str();
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+#include "ofMain.h"
+#include "ofxImGui.h"
+#include "ImHelpers.h"
+#include "LogViewer.h"
+#include "ClippedGroup.h"
+#include "SearchableGroup.h"
+#include "ValuesEditor.h"
+#include "TimeSeries.h"
+#include "DrawListShapes.h"
+#include "GuiFrameScheduler.h"
+
+// Headless benchmark of ofxImGui, for tracking its overhead across releases.
+// Each workload runs a number of complete frames (begin, widgets, end, render) and reports
+// per-frame CPU time, ImGui allocations and vertex/index counts as JSON.
+
+class ofApp : public ofBaseApp{
+
+	public:
+        struct BenchmarkOptions {
+            int frames = 200;
+            int warmupFrames = 20;
+            std::string only; // Run a single workload
+            std::string outputPath = "benchmark.json"; // Relative to bin/data
+        };
+
+        explicit ofApp(const BenchmarkOptions& _options) : options(_options) {}
+
+        void setup() override;
+        void update() override;
+        void exit() override;
+
+    private:
+        struct DrawCounts {
+            int vtx = 0;
+            int idx = 0;
+            int drawLists = 0;
+            int drawCmds = 0;
+        };
+
+        struct WorkloadResult {
+            std::string name;
+            int contexts = 1;
+            std::vector<float> frameMs;
+            double allocsPerFrame = 0;
+            double bytesPerFrame = 0;
+            DrawCounts counts; // Of the last frame
+            float phaseAvgMs[ofxImGui::FrameProfiler::NumPhases] = {};
+            double phaseAllocsPerFrame[ofxImGui::FrameProfiler::NumPhases] = {}; // Main context only
+        };
+
+        // Single context workload : buildFunc submits the widgets of one frame
+        void runWorkload(const std::string& name, std::function<void(int frame)> buildFunc);
+        // All extra contexts, built in parallel when OFXIMGUI_ENABLE_THREADED_CONTEXTS is set
+        void runMultiContextWorkload(const std::string& name, std::function<void(int frame)> buildFunc);
+
+        static void addDrawCounts(DrawCounts& counts);
+        ofxImGui::AllocationTracker::Counters getAllocationTotals() const;
+        bool shouldRun(const std::string& name) const;
+        std::string getJson() const;
+
+        // Workloads
+        void buildManyWindows(int frame, int numWindows);
+        void buildBigTable(int frame);
+        void buildDeepGroup(int frame);
+        void buildFlatGroup(int frame);
+        void buildClippedGroup(int frame);
+        void buildSearchableGroup(int frame);
+        void buildLargeValues(int frame);
+        void buildValuesEditor(int frame);
+        void buildTimeSeries(int frame);
+        void buildShapes(int frame);
+        void buildLogViewer(int frame);
+
+        BenchmarkOptions options;
+        std::vector<WorkloadResult> results;
+        bool hasRun = false;
+
+        ofxImGui::Gui gui;
+
+        std::vector<std::shared_ptr<ofAppBaseWindow>> extraWindows;
+        std::vector<std::unique_ptr<ofxImGui::Gui>> extraGuis;
+        ofxImGui::GuiFrameScheduler scheduler;
+
+        // Workload data
+        float sliderValues[1000] = {};
+        ofParameterGroup deepGroup;
+        ofParameterGroup flatGroup; // 10k parameters, with duplicate names
+        ofxImGui::ClippedGroup clippedGroup;
+        ofxImGui::SearchableGroup searchableGroup;
+        std::vector<glm::vec3> largeValues;
+        ofxImGui::ValuesEditor valuesEditor;
+        ofxImGui::TimeSeries timeSeries; // 10M samples
+        ofxImGui::TimeSeriesView timeSeriesView;
+        ofPolyline longPolyline; // 100k points
+        ofxImGui::LoggerChannel logger;
+        ofxImGui::LogViewer logViewer;
+};
@@ -0,0 +1,5 @@
+#pragma once
+
+// Project-wide ofxImGui settings, loaded by ofxImGuiConstants.h (C++17).
+// The benchmark runs headless : no input, no GPU submission.
+#define OFXIMGUI_FORCE_NULL_BACKEND
@@ -0,0 +1,140 @@
+#include "AllocationTracker.h"
+
+#include "imgui.h"
+
+#include <cstdlib>
+
+namespace ofxImGui
+{
+	// Attribution of the calling thread
+	static thread_local AllocationTracker* currentTracker = nullptr;
+	static thread_local int currentPhase = 0;
+
+	static std::atomic<bool> trackerInstalled(false);
+	static std::atomic<std::size_t> untrackedAllocs(0);
+	static std::atomic<std::size_t> untrackedFrees(0);
+	static std::atomic<std::size_t> untrackedBytes(0);
+
+	//--------------------------------------------------------------
+	void* AllocationTracker::trackedAlloc(std::size_t size, void* userData){
+		(void)userData;
+		AllocationTracker* tracker = currentTracker;
+		if(tracker){
+			AtomicCounters& counters = tracker->totals[currentPhase];
+			counters.allocs.fetch_add(1, std::memory_order_relaxed);
+			counters.bytes.fetch_add(size, std::memory_order_relaxed);
+		}
+		else {
+			untrackedAllocs.fetch_add(1, std::memory_order_relaxed);
+			untrackedBytes.fetch_add(size, std::memory_order_relaxed);
+		}
+		return std::malloc(size);
+	}
+
+	//--------------------------------------------------------------
+	void AllocationTracker::trackedFree(void* ptr, void* userData){
+		(void)userData;
+		if(ptr == nullptr) return;
+		AllocationTracker* tracker = currentTracker;
+		if(tracker) tracker->totals[currentPhase].frees.fetch_add(1, std::memory_order_relaxed);
+		else untrackedFrees.fetch_add(1, std::memory_order_relaxed);
+		std::free(ptr);
+	}
+
+	//--------------------------------------------------------------
+	void AllocationTracker::install(){
+		// Same underlying allocator as ImGui's default : memory allocated before can still be freed
+		ImGui::SetAllocatorFunctions(&AllocationTracker::trackedAlloc, &AllocationTracker::trackedFree, nullptr);
+		trackerInstalled = true;
+	}
+
+	//--------------------------------------------------------------
+	bool AllocationTracker::isInstalled(){
+		return trackerInstalled;
+	}
+
+	//--------------------------------------------------------------
+	AllocationTracker::Counters AllocationTracker::AtomicCounters::load() const {
+		Counters counters;
+		counters.allocs = allocs.load(std::memory_order_relaxed);
+		counters.frees = frees.load(std::memory_order_relaxed);
+		counters.bytes = bytes.load(std::memory_order_relaxed);
+		return counters;
+	}
+
+	//--------------------------------------------------------------
+	AllocationTracker::Counters AllocationTracker::getFrameCounters(int phase) const {
+		if(phase < 0 || phase >= MaxPhases) return Counters();
+		return lastFrame[phase];
+	}
+
+	//--------------------------------------------------------------
+	AllocationTracker::Counters AllocationTracker::getFrameCounters() const {
+		Counters sum;
+		for(const Counters& counters : lastFrame){
+			sum.allocs += counters.allocs;
+			sum.frees += counters.frees;
+			sum.bytes += counters.bytes;
+		}
+		return sum;
+	}
+
+	//--------------------------------------------------------------
+	AllocationTracker::Counters AllocationTracker::getTotalCounters(int phase) const {
+		if(phase < 0 || phase >= MaxPhases) return Counters();
+		return totals[phase].load();
+	}
+
+	//--------------------------------------------------------------
+	AllocationTracker::Counters AllocationTracker::getUntrackedCounters(){
+		Counters counters;
+		counters.allocs = untrackedAllocs;
+		counters.frees = untrackedFrees;
+		counters.bytes = untrackedBytes;
+		return counters;
+	}
+
+	//--------------------------------------------------------------
+	void AllocationTracker::newFrame(){
+		for(int phase = 0; phase < MaxPhases; ++phase){
+			Counters total = totals[phase].load();
+			lastFrame[phase].allocs = total.allocs - frameStart[phase].allocs;
+			lastFrame[phase].frees = total.frees - frameStart[phase].frees;
+			lastFrame[phase].bytes = total.bytes - frameStart[phase].bytes;
+			frameStart[phase] = total;
+		}
+	}
+
+	//--------------------------------------------------------------
+	void AllocationTracker::reset(){
+		for(int phase = 0; phase < MaxPhases; ++phase){
+			totals[phase].allocs = 0;
+			totals[phase].frees = 0;
+			totals[phase].bytes = 0;
+			frameStart[phase] = Counters();
+			lastFrame[phase] = Counters();
+		}
+	}
+
+	//--------------------------------------------------------------
+	void AllocationTracker::setCurrent(AllocationTracker* tracker, int phase){
+		currentTracker = tracker;
+		currentPhase = (phase >= 0 && phase < MaxPhases) ? phase : 0;
+	}
+
+	//--------------------------------------------------------------
+	AllocationTracker* AllocationTracker::getCurrent(int& phase){
+		phase = currentPhase;
+		return currentTracker;
+	}
+
+	//--------------------------------------------------------------
+	AllocationTracker::Scope::Scope(AllocationTracker* tracker, int phase) : previousTracker(currentTracker), previousPhase(currentPhase) {
+		setCurrent(tracker, phase);
+	}
+
+	//--------------------------------------------------------------
+	AllocationTracker::Scope::~Scope(){
+		setCurrent(previousTracker, previousPhase);
+	}
+}
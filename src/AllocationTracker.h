@@ -0,0 +1,74 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+// Counts the allocations made through ImGui's allocator (ImGui internals, IM_ALLOC, ImVector...), per frame phase and per context.
+// install() sets counting hooks with ImGui::SetAllocatorFunctions(). They forward to malloc/free, like ImGui's default allocator.
+// Each allocation is attributed to the tracker and phase set on the calling thread :
+// FrameProfiler::Scope sets them for each measured phase, Gui::begin()/end() for your widgets.
+// Allocations made outside of any phase (context creation, helpers called outside of a frame...) are counted as untracked.
+// Usage :
+//   In main(), before gui.setup() : ofxImGui::AllocationTracker::install();
+//   Later : gui.getProfiler()->getAllocations().getFrameCounters(ofxImGui::FrameProfiler::UserCode).allocs;
+
+namespace ofxImGui
+{
+	class AllocationTracker
+	{
+	public:
+		static constexpr int MaxPhases = 8; // >= FrameProfiler::NumPhases
+
+		struct Counters {
+			std::size_t allocs = 0;
+			std::size_t frees = 0;
+			std::size_t bytes = 0; // Allocated bytes (freed sizes are unknown)
+		};
+
+		AllocationTracker(){}
+
+		// Prevent making copies
+		AllocationTracker( const AllocationTracker& ) = delete;
+		AllocationTracker& operator=( const AllocationTracker& ) = delete;
+
+		// Sets the counting allocator. Don't use it if you set your own ImGui allocator.
+		static void install();
+		static bool isInstalled();
+
+		// Counts of the last complete frame, and since the last reset
+		Counters getFrameCounters(int phase) const;
+		Counters getTotalCounters(int phase) const;
+		Counters getFrameCounters() const; // All phases
+		static Counters getUntrackedCounters();
+
+		void newFrame(); // Closes the frame counts, called by Gui when a frame begins
+		void reset();
+
+		// Attributes the allocations of the calling thread
+		static void setCurrent(AllocationTracker* tracker, int phase);
+		static AllocationTracker* getCurrent(int& phase);
+
+		// Attributes the allocations of the calling thread until it goes out of scope
+		struct Scope {
+			Scope(AllocationTracker* tracker, int phase);
+			~Scope();
+			AllocationTracker* previousTracker;
+			int previousPhase;
+		};
+
+	private:
+		struct AtomicCounters {
+			std::atomic<std::size_t> allocs{0};
+			std::atomic<std::size_t> frees{0};
+			std::atomic<std::size_t> bytes{0};
+			Counters load() const;
+		};
+
+		static void* trackedAlloc(std::size_t size, void* userData);
+		static void trackedFree(void* ptr, void* userData);
+
+		AtomicCounters totals[MaxPhases];
+		Counters frameStart[MaxPhases];
+		Counters lastFrame[MaxPhases];
+	};
+}
@@ -41,6 +41,28 @@ namespace ofxImGui
 		return new_texture; // And who will clean up the garbage ? Seemingly nobody...
 	};
 
+	//--------------------------------------------------------------
+	void BaseEngine::renderDrawData(ImDrawData* /*drawData*/){
+		ofLogWarning("BaseEngine::renderDrawData()") << "This engine doesn't support rendering draw data snapshots.";
+	}
+
+	//--------------------------------------------------------------
+	bool BaseEngine::beginGpuTimer(){
+		if(profiler == nullptr || !profiler->isGpuTimingEnabled()) return false;
+		return gpuTimer.begin();
+	}
+
+	//--------------------------------------------------------------
+	void BaseEngine::endGpuTimer(){
+		gpuTimer.end();
+
+		// Collect finished measures from previous frames
+		float ms;
+		while(gpuTimer.poll(ms)){
+			if(profiler) profiler->addGpuSample(FrameProfiler::EngineRender, ms);
+		}
+	}
+
 	//--------------------------------------------------------------
 	bool BaseEngine::setImGuiContext(){
 		if( isSetup == false || imguiContext == nullptr){
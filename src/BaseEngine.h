@@ -5,6 +5,8 @@
 
 // Seems needed on windows
 #include "imgui.h"
+#include "FrameProfiler.h"
+#include "GpuTimer.h"
 //struct ImGuiContext;
 
 // Fwd declaration
@@ -40,6 +42,12 @@ namespace ofxImGui
 		virtual void newFrame() = 0;
         virtual void render() = 0;
 
+		// Split render steps, for submitting a frame from a snapshot (see Gui::setDeferredRendering()).
+		// render() is equivalent to updateTextures() + renderDrawData() + updatePlatformWindows() with the current draw data.
+		virtual void updateTextures(ImDrawData* /*drawData*/){}
+		virtual void renderDrawData(ImDrawData* drawData);
+		virtual void updatePlatformWindows(){}
+
         virtual bool updateFontsTexture() = 0;
 
 		// This is here to keep a compatibility layer with old codebases.
@@ -59,6 +67,14 @@ namespace ofxImGui
 		// For handling events, as we don't know which context is set when they are called
 		ImGuiContext* imguiContext = nullptr;
 		ImGuiContext* imguiContextPrev = nullptr;
+
+		// Profiler of the owning ofxImGuiContext, set by Gui
+		FrameProfiler* profiler = nullptr;
+
+		// GPU timing of the GUI draw in the main window
+		GpuTimer gpuTimer;
+		bool beginGpuTimer();
+		void endGpuTimer();
 	};
 }
 
@@ -0,0 +1,157 @@
+#include "ClippedGroup.h"
+
+namespace ofxImGui
+{
+	//--------------------------------------------------------------
+	bool ClippedGroup::draw(ofParameterGroup& group, Settings& settings){
+		bool changed = false;
+		if(settings.windowBlock){
+			if(BeginTree(group, settings)){
+				changed = drawRows(group, settings);
+				EndTree(settings);
+			}
+		}
+		else {
+			if(BeginWindow(group.getName(), settings)){
+				changed = drawRows(group, settings);
+			}
+			EndWindow(settings);
+		}
+		return changed;
+	}
+
+	//--------------------------------------------------------------
+	bool ClippedGroup::drawRows(ofParameterGroup& group, Settings& settings){
+		sync(group);
+
+		bool changed = false;
+		numDrawnRows = 0;
+		const float indentSpacing = ImGui::GetStyle().IndentSpacing;
+		PushCommitPolicy(settings.commitPolicy, settings.commitInterval);
+		ImGuiListClipper clipper;
+		clipper.Begin((int)rows.size());
+		while(clipper.Step()){
+			for(int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row){
+				const int index = rows[row];
+				Node& node = nodes[index];
+				const float indent = (node.depth - 1) * indentSpacing; // Root children aren't indented
+				if(indent > 0) ImGui::Indent(indent);
+				ImGui::PushID(index);
+				if(node.group){
+					// Frame padding : same height as the parameter rows
+					ImGui::SetNextItemOpen(node.open, ImGuiCond_Always);
+					bool open = ImGui::TreeNodeEx(node.name.c_str(), ImGuiTreeNodeFlags_NoTreePushOnOpen | ImGuiTreeNodeFlags_FramePadding | (node.depth == 1 ? ImGuiTreeNodeFlags_Framed : ImGuiTreeNodeFlags_None));
+					if(open != node.open){
+						node.open = open;
+						openStates[node.group->getInternalObject()] = open;
+						rowsDirty = true; // Listed again after this frame
+					}
+				}
+				else {
+					// Unique names within the row only, so labels don't change while scrolling
+					PushUniqueNameScope();
+					changed |= AddParameter(*node.parameter, settings);
+					PopUniqueNameScope();
+				}
+				ImGui::PopID();
+				if(indent > 0) ImGui::Unindent(indent);
+				++numDrawnRows;
+			}
+		}
+		clipper.End();
+		PopCommitPolicy();
+
+		if(rowsDirty) updateRows();
+		return changed;
+	}
+
+	//--------------------------------------------------------------
+	void ClippedGroup::invalidate(){
+		isDirty = true;
+	}
+
+	//--------------------------------------------------------------
+	void ClippedGroup::setAllOpen(bool open){
+		for(Node& node : nodes){
+			if(node.group && node.depth > 0){
+				node.open = open;
+				openStates[node.group->getInternalObject()] = open;
+			}
+		}
+		rowsDirty = true;
+	}
+
+	//--------------------------------------------------------------
+	void ClippedGroup::sync(ofParameterGroup& group){
+		if(group.getInternalObject() != groupObject){
+			isDirty = true;
+		}
+		else if(!isDirty){
+			// Structural changes : only groups are checked, not every parameter
+			for(int index : groupNodes){
+				const Node& node = nodes[index];
+				if(node.group->size() != node.groupSize){
+					isDirty = true;
+					break;
+				}
+			}
+		}
+
+		if(isDirty){
+			nodes.clear();
+			groupNodes.clear();
+			groupObject = group.getInternalObject();
+			flatten(std::make_shared<ofParameterGroup>(group), 0); // Copies share the same parameters
+			isDirty = false;
+			rowsDirty = true;
+		}
+		if(rowsDirty){
+			updateRows();
+		}
+	}
+
+	//--------------------------------------------------------------
+	void ClippedGroup::flatten(const std::shared_ptr<ofParameterGroup>& group, int depth){
+		const int index = (int)nodes.size();
+		groupNodes.push_back(index);
+		nodes.emplace_back();
+		{
+			Node& node = nodes.back();
+			node.parameter = group;
+			node.group = group;
+			node.name = group->getName();
+			node.groupSize = group->size();
+			node.depth = depth;
+			auto openState = openStates.find(group->getInternalObject());
+			if(openState != openStates.end()) node.open = openState->second;
+		}
+
+		for(auto& parameter : *group){
+			auto subGroup = std::dynamic_pointer_cast<ofParameterGroup>(parameter);
+			if(subGroup){
+				flatten(subGroup, depth + 1);
+			}
+			else {
+				nodes.emplace_back();
+				Node& node = nodes.back();
+				node.parameter = parameter;
+				node.depth = depth + 1;
+				node.end = (int)nodes.size();
+			}
+		}
+		nodes[index].end = (int)nodes.size();
+	}
+
+	//--------------------------------------------------------------
+	void ClippedGroup::updateRows(){
+		rows.clear();
+		// nodes[0] is the root group, drawn as the window or tree
+		int index = 1;
+		while(index < (int)nodes.size()){
+			rows.push_back(index);
+			const Node& node = nodes[index];
+			index = (node.group && !node.open) ? node.end : index + 1;
+		}
+		rowsDirty = false;
+	}
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "ImHelpers.h"
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Draws huge ofParameterGroups : only the visible rows build widgets.
+// - The group tree is flattened once into a node list, with the expand/collapse state of each sub-group.
+//   It's rebuilt when the group changes : another group is drawn, or a (sub-)group size changed (checked each frame, per group).
+//   Call invalidate() after other structural changes (renaming, replacing parameters).
+// - Visible rows (nodes not in a collapsed group) are only listed again when a group is toggled.
+// - Rows are submitted with ImGuiListClipper : frame cost scales with the visible rows, not with the group size.
+// Widgets come from the AddGroup() handlers (see RegisterParameterHandler()), they need a single line height.
+// Usage :
+//   ofxImGui::ClippedGroup clippedGroup; // Member of your ofApp, one per drawn group
+//   In draw() : clippedGroup.draw(group, settings);
+
+namespace ofxImGui
+{
+	class ClippedGroup
+	{
+	public:
+		// Like AddGroup() : in a new window, or inline when already in a window block. Returns true if a parameter changed.
+		bool draw(ofParameterGroup& group, Settings& settings);
+		// Draws the rows in the current window
+		bool drawRows(ofParameterGroup& group, Settings& settings);
+
+		void invalidate();
+		void setAllOpen(bool open); // Expands or collapses all sub-groups
+
+		std::size_t getNumNodes() const { return nodes.size(); }
+		std::size_t getNumRows() const { return rows.size(); } // Not collapsed
+		int getNumDrawnRows() const { return numDrawnRows; } // During the last frame
+
+	private:
+		struct Node {
+			std::shared_ptr<ofAbstractParameter> parameter;
+			std::shared_ptr<ofParameterGroup> group; // Set for sub-groups
+			std::string name; // Group label
+			std::size_t groupSize = 0; // When flattened
+			int depth = 0;
+			int end = 0; // Index after the subtree
+			bool open = true;
+		};
+
+		void sync(ofParameterGroup& group);
+		void flatten(const std::shared_ptr<ofParameterGroup>& group, int depth);
+		void updateRows();
+
+		std::vector<Node> nodes; // Depth-first, nodes[0] is the root group
+		std::vector<int> rows;   // Indexes of the visible nodes
+		std::vector<int> groupNodes; // Indexes of the group nodes, checked for structural changes each frame
+		std::unordered_map<const void*, bool> openStates; // By internal object, kept across rebuilds
+		const void* groupObject = nullptr;
+		bool isDirty = true;
+		bool rowsDirty = true;
+		int numDrawnRows = 0;
+	};
+}
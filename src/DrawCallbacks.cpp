@@ -0,0 +1,214 @@
+#include "DrawCallbacks.h"
+
+#include "ImHelpers.h" // CalcWidgetSize(), AddWidgetLabel()
+#include "ofGLProgrammableRenderer.h"
+#include "ofGraphics.h"
+
+#include <algorithm>
+
+namespace ofxImGui
+{
+	namespace
+	{
+		// GUI coordinates of the viewport the callback is rendered in, recorded with the callback
+		struct CallbackView
+		{
+			ImVec2 displayPos;
+			ImVec2 displaySize;
+			ImVec2 framebufferScale;
+		};
+
+		struct FunctionCallbackData
+		{
+			const DrawFunction* function;
+			ImVec2 rectMin;
+			ImVec2 rectMax;
+			CallbackView view;
+		};
+
+		thread_local DrawFunctionStore* currentStore = nullptr;
+
+		struct VboCallbackData
+		{
+			const ofVbo* vbo;
+			const ofShader* shader;
+			GLenum mode;
+			int first;
+			int count;
+			int instances;
+			DrawTransform transform;
+			CallbackView view;
+		};
+
+		// OF drawing only works in the GL context of the main viewport
+		bool canRecordCallback(){
+#if defined(OFXIMGUI_BACKEND_VULKAN) || defined(OFXIMGUI_BACKEND_NULL)
+			return false;
+#else
+			return ImGui::GetWindowViewport() == ImGui::GetMainViewport();
+#endif
+		}
+
+		CallbackView getCallbackView(){
+			const ImGuiViewport* viewport = ImGui::GetWindowViewport();
+			return { viewport->Pos, viewport->Size, viewport->FramebufferScale };
+		}
+
+		// Rect in window pixels, origin top-left
+		ofRectangle getViewport(const CallbackView& view, const ImVec2& rectMin, const ImVec2& rectMax){
+			return ofRectangle((rectMin.x - view.displayPos.x) * view.framebufferScale.x, (rectMin.y - view.displayPos.y) * view.framebufferScale.y,
+				(rectMax.x - rectMin.x) * view.framebufferScale.x, (rectMax.y - rectMin.y) * view.framebufferScale.y);
+		}
+
+		// Prepares the OF renderer for drawing in a rect (GUI coordinates), its top-left being the origin, clipped to the command clip rect.
+		// perspective : OF default screen (ofSetupScreen()), or orthographic for 2D.
+		void beginOfDrawing(const ImDrawCmd* cmd, const CallbackView& view, const ImVec2& rectMin, const ImVec2& rectMax, bool perspective){
+			if(ofIsGLProgrammableRenderer()){
+				// The GUI renderer bound its program behind the back of OF, which skips binding the shader it thinks is bound
+				auto renderer = std::dynamic_pointer_cast<ofGLProgrammableRenderer>(ofGetCurrentRenderer());
+				if(renderer) glUseProgram(renderer->getCurrentShader().getProgram());
+			}
+#if !defined(TARGET_OPENGLES)
+			else {
+				glDisable(GL_TEXTURE_2D); // Enabled for the GUI, would modulate the OF colors with the font atlas
+			}
+#endif
+			const float framebufferHeight = view.displaySize.y * view.framebufferScale.y;
+			const ImVec2 clipMin((cmd->ClipRect.x - view.displayPos.x) * view.framebufferScale.x, (cmd->ClipRect.y - view.displayPos.y) * view.framebufferScale.y);
+			const ImVec2 clipMax((cmd->ClipRect.z - view.displayPos.x) * view.framebufferScale.x, (cmd->ClipRect.w - view.displayPos.y) * view.framebufferScale.y);
+			glEnable(GL_SCISSOR_TEST);
+			glScissor((GLint)clipMin.x, (GLint)(framebufferHeight - clipMax.y), (GLsizei)std::max(0.0f, clipMax.x - clipMin.x), (GLsizei)std::max(0.0f, clipMax.y - clipMin.y));
+
+			const ofRectangle viewport = getViewport(view, rectMin, rectMax);
+			ofPushView();
+			ofViewport(viewport.x, framebufferHeight - (viewport.y + viewport.height), viewport.width, viewport.height, false); // GL origin : bottom-left
+			if(perspective) ofSetupScreenPerspective(rectMax.x - rectMin.x, rectMax.y - rectMin.y);
+			else ofSetupScreenOrtho(rectMax.x - rectMin.x, rectMax.y - rectMin.y, -1, 1);
+			ofPushMatrix();
+		}
+
+		void endOfDrawing(){
+			ofPopMatrix();
+			ofPopView();
+		}
+
+		void drawFunction(const ImDrawList*, const ImDrawCmd* cmd){
+			const FunctionCallbackData& data = *(const FunctionCallbackData*)cmd->UserCallbackData;
+			beginOfDrawing(cmd, data.view, data.rectMin, data.rectMax, true);
+			(*data.function)(getViewport(data.view, data.rectMin, data.rectMax));
+			endOfDrawing();
+		}
+
+		void drawVbo(const ImDrawList*, const ImDrawCmd* cmd){
+			const VboCallbackData& data = *(const VboCallbackData*)cmd->UserCallbackData;
+			// Whole display, for the GUI coordinates of the transform
+			const ImVec2 displayMax(data.view.displayPos.x + data.view.displaySize.x, data.view.displayPos.y + data.view.displaySize.y);
+			beginOfDrawing(cmd, data.view, data.view.displayPos, displayMax, false);
+			ofTranslate(data.transform.offset.x - data.view.displayPos.x, data.transform.offset.y - data.view.displayPos.y);
+			ofScale(data.transform.scale.x, data.transform.scale.y, 1);
+			if(data.shader) data.shader->begin();
+#if !defined(TARGET_OPENGLES)
+			const bool programPointSize = data.shader && data.mode == GL_POINTS;
+			if(programPointSize) glEnable(GL_PROGRAM_POINT_SIZE);
+#endif
+			if(data.instances > 1) data.vbo->drawInstanced(data.mode, data.first, data.count, data.instances);
+			else data.vbo->draw(data.mode, data.first, data.count);
+#if !defined(TARGET_OPENGLES)
+			if(programPointSize) glDisable(GL_PROGRAM_POINT_SIZE);
+#endif
+			if(data.shader) data.shader->end();
+			endOfDrawing();
+		}
+	}
+
+	//--------------------------------------------------------------
+	DrawFunctionStore::~DrawFunctionStore(){
+		if(currentStore == this) currentStore = nullptr;
+	}
+
+	//--------------------------------------------------------------
+	const DrawFunction* DrawFunctionStore::add(DrawFunction function, int frame){
+		functions.push_back({ frame, std::move(function) });
+		return &functions.back().function;
+	}
+
+	//--------------------------------------------------------------
+	void DrawFunctionStore::release(int oldestFrame){
+		while(!functions.empty() && functions.front().frame < oldestFrame){
+			functions.pop_front();
+		}
+	}
+
+	//--------------------------------------------------------------
+	void DrawFunctionStore::clear(){
+		functions.clear();
+	}
+
+	//--------------------------------------------------------------
+	DrawFunctionStore* DrawFunctionStore::getCurrent(){
+		return currentStore;
+	}
+
+	//--------------------------------------------------------------
+	void DrawFunctionStore::setCurrent(DrawFunctionStore* store){
+		currentStore = store;
+	}
+
+	//--------------------------------------------------------------
+	bool AddVbo(ImDrawList* drawList, const ofVbo& vbo, GLenum mode, int first, int count, const DrawTransform& transform, const ofShader* shader, int instances){
+		if(count <= 0 || instances <= 0 || !canRecordCallback()) return false;
+		const VboCallbackData data = { &vbo, shader, mode, first, count, instances, transform, getCallbackView() };
+		drawList->AddCallback(drawVbo, (void*)&data, sizeof(data)); // Copied into the draw list
+		drawList->AddCallback(ImDrawCallback_ResetRenderState, nullptr);
+		return true;
+	}
+
+	//--------------------------------------------------------------
+	bool AddDrawFunction(ImDrawList* drawList, const ImVec2& rectMin, const ImVec2& rectMax, DrawFunction function){
+		DrawFunctionStore* store = DrawFunctionStore::getCurrent();
+		if(store == nullptr || !function || rectMax.x <= rectMin.x || rectMax.y <= rectMin.y || !canRecordCallback()) return false;
+		const FunctionCallbackData data = { store->add(std::move(function), ImGui::GetFrameCount()), rectMin, rectMax, getCallbackView() };
+		drawList->AddCallback(drawFunction, (void*)&data, sizeof(data)); // Copied into the draw list
+		drawList->AddCallback(ImDrawCallback_ResetRenderState, nullptr);
+		return true;
+	}
+
+	//--------------------------------------------------------------
+	bool AddDrawFunction(const char* label, DrawFunction function, ImVec2 size){
+		size = CalcWidgetSize(size, ImGui::GetFrameHeight() * 8);
+
+		ImGui::InvisibleButton(label, size);
+		const bool hovered = ImGui::IsItemHovered();
+		if(ImGui::IsItemVisible()){
+			AddDrawFunction(ImGui::GetWindowDrawList(), ImGui::GetItemRectMin(), ImGui::GetItemRectMax(), std::move(function));
+		}
+		return hovered;
+	}
+
+	//--------------------------------------------------------------
+	bool AddVboCanvas(const char* label, const ofVbo& vbo, GLenum mode, int count, const ofRectangle& bounds, ImVec2 size, const ofShader* shader, int instances){
+		const ImGuiStyle& style = ImGui::GetStyle();
+		size = CalcWidgetSize(size, ImGui::GetFrameHeight() * 8);
+
+		ImGui::InvisibleButton(label, size);
+		const bool hovered = ImGui::IsItemHovered();
+		const ImVec2 frameMin = ImGui::GetItemRectMin();
+		const ImVec2 frameMax = ImGui::GetItemRectMax();
+		const ImVec2 innerMin(frameMin.x + style.FramePadding.x, frameMin.y + style.FramePadding.y);
+		const ImVec2 innerMax(frameMax.x - style.FramePadding.x, frameMax.y - style.FramePadding.y);
+		AddWidgetLabel(label);
+
+		ImDrawList* drawList = ImGui::GetWindowDrawList();
+		drawList->AddRectFilled(frameMin, frameMax, ImGui::GetColorU32(ImGuiCol_FrameBg), style.FrameRounding);
+		if(bounds.width == 0 || bounds.height == 0 || innerMax.x <= innerMin.x || innerMax.y <= innerMin.y){
+			return hovered;
+		}
+
+		const ImVec2 scale((innerMax.x - innerMin.x) / bounds.width, (innerMax.y - innerMin.y) / bounds.height);
+		const DrawTransform transform(ImVec2(innerMin.x - bounds.x * scale.x, innerMin.y - bounds.y * scale.y), scale);
+		drawList->PushClipRect(innerMin, innerMax, true);
+		AddVbo(drawList, vbo, mode, 0, count, transform, shader, instances);
+		drawList->PopClipRect();
+		return hovered;
+	}
+}
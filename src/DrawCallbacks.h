@@ -0,0 +1,68 @@
+#pragma once
+
+#include "ofxImGuiConstants.h"
+#include "DrawListShapes.h" // DrawTransform
+#include "ofVbo.h"
+#include "ofShader.h"
+#include "ofRectangle.h"
+#include "imgui.h"
+
+#include <deque>
+#include <functional>
+
+// OpenFrameworks drawing inside ImGui draw lists, with draw callbacks (ImDrawCallback) run by the renderer.
+// - Geometry stays on the GPU : a 200k points ofVbo costs one draw command in the GUI, instead of 200k quads of ImGui vertices each frame.
+// - When the renderer reaches the callback, the OF matrices are set to the GUI coordinates (with the DrawTransform of the canvas),
+//   drawing is clipped to the ImGui clip rect (scissor), then the ImGui render state is reset (ImDrawCallback_ResetRenderState).
+// - The vbo and shader are referenced, not copied : they have to stay valid until the GUI is rendered (renderDeferred() with deferred rendering).
+// - Draw functions (ofDrawCircle(), ofDrawBox()...) are run with the OF viewport and screen matrices set to their item rect : no FBO per panel.
+//   They are kept by the ofxImGuiContext until no frame using them can be rendered anymore (they need a Gui frame).
+// - OpenGL renderers only, in the main viewport (VAOs aren't shared with the GL contexts of other viewports). Returns false when nothing was recorded.
+// - With a shader and GL_POINTS, GL_PROGRAM_POINT_SIZE is enabled : the vertex shader sets gl_PointSize.
+// Usage :
+//   ofVbo points; ofShader pointShader; // Members of your ofApp, points.setVertexData(...) in setup()
+//   In draw() : ofxImGui::AddVboCanvas("Scatter", points, GL_POINTS, numPoints, ofRectangle(0, 0, 1, 1), ImVec2(-1, 400), &pointShader);
+//   Or in a custom widget : ofxImGui::AddVbo(ImGui::GetWindowDrawList(), points, GL_POINTS, 0, numPoints, transform, &pointShader);
+//   Or any OF drawing : ofxImGui::AddDrawFunction("Preview", [](const ofRectangle& viewport){ ofDrawCircle(100, 100, 50); }, ImVec2(200, 200));
+
+namespace ofxImGui
+{
+	// Records a draw of count vertices of the vbo from first (instanced when instances > 1), using the OF default shader when shader is null
+	bool AddVbo(ImDrawList* drawList, const ofVbo& vbo, GLenum mode, int first, int count, const DrawTransform& transform = DrawTransform(), const ofShader* shader = nullptr, int instances = 1);
+
+	// viewport : the rect in window pixels (origin top-left), for ofCamera::begin(viewport). Local coordinates of the drawing are in GUI units.
+	typedef std::function<void(const ofRectangle& viewport)> DrawFunction;
+
+	// Draw functions recorded by the frames of a context, one per ofxImGuiContext.
+	// Gui makes it current while a frame is built, and releases the functions once their frame can't be rendered anymore.
+	class DrawFunctionStore
+	{
+	public:
+		~DrawFunctionStore();
+
+		const DrawFunction* add(DrawFunction function, int frame); // The address stays valid until released
+		void release(int oldestFrame); // Releases the functions of the frames before oldestFrame, the oldest frame that can still be rendered
+		void clear();
+		std::size_t size() const { return functions.size(); }
+
+		// Store of the frame being built on the calling thread, set by Gui
+		static DrawFunctionStore* getCurrent();
+		static void setCurrent(DrawFunctionStore* store);
+
+	private:
+		struct RecordedFunction
+		{
+			int frame;
+			DrawFunction function;
+		};
+		std::deque<RecordedFunction> functions; // A deque keeps the recorded addresses valid
+	};
+
+	// Records a call of the function, drawing in the rect (GUI coordinates) and clipped to the current clip rect
+	bool AddDrawFunction(ImDrawList* drawList, const ImVec2& rectMin, const ImVec2& rectMax, DrawFunction drawFunction);
+	// Item drawn by the function, size as ImGui sizes. Returns true when hovered.
+	bool AddDrawFunction(const char* label, DrawFunction drawFunction, ImVec2 size = ImVec2(0, 0));
+
+	// Frame showing the vbo, bounds (vbo coordinates, y down) fitted to the frame. Returns true when hovered.
+	bool AddVboCanvas(const char* label, const ofVbo& vbo, GLenum mode, int count, const ofRectangle& bounds, ImVec2 size = ImVec2(0, 0), const ofShader* shader = nullptr, int instances = 1);
+}
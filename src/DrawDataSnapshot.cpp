@@ -0,0 +1,161 @@
+#include "DrawDataSnapshot.h"
+
+#include <algorithm>
+#include <climits> // INT_MAX
+#include <cstring> // memcpy
+
+namespace ofxImGui
+{
+	//--------------------------------------------------------------
+	DrawDataSnapshot::DrawDataSnapshot(){
+		drawData.Clear();
+	}
+
+	//--------------------------------------------------------------
+	DrawDataSnapshot::~DrawDataSnapshot(){
+		drawData.Clear();
+		for(ImDrawList* list : listPool){
+			IM_DELETE(list);
+		}
+		listPool.clear();
+	}
+
+	//--------------------------------------------------------------
+	void DrawDataSnapshot::capture(const ImDrawData* src, int _frame){
+		frame = _frame;
+		// Keep our lists, only reset the pointers
+		drawData.CmdLists.resize(0);
+
+		if(src == nullptr || !src->Valid){
+			drawData.Valid = false;
+			drawData.CmdListsCount = drawData.TotalIdxCount = drawData.TotalVtxCount = 0;
+			return;
+		}
+
+		// Grow the pool if needed.
+		// Note: no shared data, our lists are never used for drawing, and must not be registered to the context.
+		while(listPool.Size < src->CmdLists.Size){
+			listPool.push_back(IM_NEW(ImDrawList)(nullptr));
+		}
+
+		for(int i = 0; i < src->CmdLists.Size; ++i){
+			copyDrawList(listPool[i], src->CmdLists[i]);
+			drawData.CmdLists.push_back(listPool[i]);
+		}
+
+		drawData.Valid            = true;
+		drawData.CmdListsCount    = src->CmdListsCount;
+		drawData.TotalIdxCount    = src->TotalIdxCount;
+		drawData.TotalVtxCount    = src->TotalVtxCount;
+		drawData.DisplayPos       = src->DisplayPos;
+		drawData.DisplaySize      = src->DisplaySize;
+		drawData.FramebufferScale = src->FramebufferScale;
+		drawData.OwnerViewport    = nullptr; // Belongs to the context, don't reference it from another thread
+#if IMGUI_VERSION_NUM >= 19200
+		drawData.Textures         = nullptr; // Texture updates are applied before capturing
+#endif
+	}
+
+	//--------------------------------------------------------------
+	void DrawDataSnapshot::clear(){
+		drawData.Clear();
+	}
+
+	//--------------------------------------------------------------
+	std::size_t DrawDataSnapshot::getMemoryUsage() const {
+		std::size_t bytes = (std::size_t)listPool.Capacity * sizeof(ImDrawList*);
+		for(const ImDrawList* list : listPool){
+			bytes += sizeof(ImDrawList);
+			bytes += (std::size_t)list->CmdBuffer.Capacity * sizeof(ImDrawCmd);
+			bytes += (std::size_t)list->IdxBuffer.Capacity * sizeof(ImDrawIdx);
+			bytes += (std::size_t)list->VtxBuffer.Capacity * sizeof(ImDrawVert);
+			bytes += (std::size_t)list->_CallbacksDataBuf.Capacity;
+		}
+		return bytes;
+	}
+
+	//--------------------------------------------------------------
+	// Note: ImVector::operator= frees and reallocates, resize() keeps the capacity.
+	void DrawDataSnapshot::copyDrawList(ImDrawList* dst, const ImDrawList* src){
+		dst->CmdBuffer.resize(src->CmdBuffer.Size);
+		if(src->CmdBuffer.Size > 0) memcpy(dst->CmdBuffer.Data, src->CmdBuffer.Data, (size_t)src->CmdBuffer.Size * sizeof(ImDrawCmd));
+#if IMGUI_VERSION_NUM >= 19200
+		// Resolve the texture ids now : the ImTextureData of the context can be destroyed by the next updateTextures() (atlas growth)
+		// while the render thread still draws this snapshot.
+		for(ImDrawCmd& cmd : dst->CmdBuffer){
+			if(cmd.TexRef._TexData != nullptr) cmd.TexRef = ImTextureRef(cmd.GetTexID());
+		}
+#endif
+
+		dst->IdxBuffer.resize(src->IdxBuffer.Size);
+		if(src->IdxBuffer.Size > 0) memcpy(dst->IdxBuffer.Data, src->IdxBuffer.Data, (size_t)src->IdxBuffer.Size * sizeof(ImDrawIdx));
+
+		dst->VtxBuffer.resize(src->VtxBuffer.Size);
+		if(src->VtxBuffer.Size > 0) memcpy(dst->VtxBuffer.Data, src->VtxBuffer.Data, (size_t)src->VtxBuffer.Size * sizeof(ImDrawVert));
+
+		dst->Flags = src->Flags;
+		dst->_OwnerName = nullptr;
+
+		// Callback data stored within the list : copy it and point commands to our copy
+		dst->_CallbacksDataBuf.resize(src->_CallbacksDataBuf.Size);
+		if(src->_CallbacksDataBuf.Size > 0){
+			memcpy(dst->_CallbacksDataBuf.Data, src->_CallbacksDataBuf.Data, (size_t)src->_CallbacksDataBuf.Size);
+			for(ImDrawCmd& cmd : dst->CmdBuffer){
+				if(cmd.UserCallback != nullptr && cmd.UserCallbackDataSize > 0 && cmd.UserCallbackDataOffset >= 0){
+					cmd.UserCallbackData = dst->_CallbacksDataBuf.Data + cmd.UserCallbackDataOffset;
+				}
+			}
+		}
+	}
+
+	//--------------------------------------------------------------
+	DrawDataBuffer::DrawDataBuffer() :
+		writeSnapshot(&snapshots[0]),
+		readySnapshot(&snapshots[1]),
+		readSnapshot(&snapshots[2])
+	{
+
+	}
+
+	//--------------------------------------------------------------
+	DrawDataSnapshot& DrawDataBuffer::getWriteSnapshot(){
+		return *writeSnapshot;
+	}
+
+	//--------------------------------------------------------------
+	void DrawDataBuffer::publish(){
+		std::lock_guard<std::mutex> lock(swapMutex);
+		std::swap(writeSnapshot, readySnapshot);
+		hasNewSnapshot = true;
+	}
+
+	//--------------------------------------------------------------
+	bool DrawDataBuffer::acquire(){
+		std::lock_guard<std::mutex> lock(swapMutex);
+		if(!hasNewSnapshot) return false;
+		std::swap(readSnapshot, readySnapshot);
+		hasNewSnapshot = false;
+		return true;
+	}
+
+	//--------------------------------------------------------------
+	DrawDataSnapshot& DrawDataBuffer::getReadSnapshot(){
+		return *readSnapshot;
+	}
+
+	//--------------------------------------------------------------
+	int DrawDataBuffer::getOldestFrame() const {
+		std::lock_guard<std::mutex> lock(swapMutex);
+		int oldest = INT_MAX;
+		// The ready snapshot is the reader's previous one after acquire(), which isn't rendered anymore
+		if(readSnapshot->isValid()) oldest = std::min(oldest, readSnapshot->getFrame());
+		if(hasNewSnapshot && readySnapshot->isValid()) oldest = std::min(oldest, readySnapshot->getFrame());
+		return oldest;
+	}
+
+	//--------------------------------------------------------------
+	std::size_t DrawDataBuffer::getMemoryUsage() const {
+		std::lock_guard<std::mutex> lock(swapMutex);
+		return snapshots[0].getMemoryUsage() + snapshots[1].getMemoryUsage() + snapshots[2].getMemoryUsage();
+	}
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "imgui.h"
+
+#include <mutex>
+
+// Deep copies of ImDrawData, so that the GUI can be submitted to GL after ImGui moved on to the next frame.
+// ImGui::GetDrawData() points to draw lists owned by the ImGuiContext, which are reset by the next ImGui::NewFrame().
+// - DrawDataSnapshot : one copy. Draw lists and their buffers are pooled and reused, no allocations once buffers reached their peak size.
+// - DrawDataBuffer   : hands snapshots from the GUI thread to a render thread without blocking either of them.
+// Notes :
+// - Texture updates (ImDrawData::Textures) are not part of the snapshot, apply them before capturing (on a thread owning the GL context).
+// - Commands reference plain texture ids, resolved when capturing : snapshots never point to the ImTextureData of the context.
+// - Callbacks are copied, including their user data when it's stored in the draw list (AddCallback() with a size).
+
+namespace ofxImGui
+{
+	class DrawDataSnapshot
+	{
+	public:
+		DrawDataSnapshot();
+		~DrawDataSnapshot();
+
+		// Prevent making copies
+		DrawDataSnapshot( const DrawDataSnapshot& ) = delete;
+		DrawDataSnapshot& operator=( const DrawDataSnapshot& ) = delete;
+
+		// Deep-copies src, reusing the pooled buffers. frame : ImGui frame count of the draw data.
+		void capture(const ImDrawData* src, int frame = -1);
+		void clear();
+
+		bool isValid() const { return drawData.Valid; }
+		int getFrame() const { return frame; }
+		ImDrawData* getDrawData() { return &drawData; }
+		const ImDrawData* getDrawData() const { return &drawData; }
+
+		// Bytes currently reserved by the pooled buffers
+		std::size_t getMemoryUsage() const;
+
+	private:
+		static void copyDrawList(ImDrawList* dst, const ImDrawList* src);
+
+		ImDrawData drawData;
+		ImVector<ImDrawList*> listPool; // Owned draw lists, grows to the maximum number of lists seen
+		int frame = -1;
+	};
+
+	// Triple buffering : the writer never waits for the reader and the reader always gets the latest complete frame.
+	// - GUI thread    : buffer.getWriteSnapshot().capture(...); buffer.publish();
+	// - Render thread : if(buffer.acquire()) render(buffer.getReadSnapshot().getDrawData());
+	class DrawDataBuffer
+	{
+	public:
+		DrawDataBuffer();
+
+		// Prevent making copies
+		DrawDataBuffer( const DrawDataBuffer& ) = delete;
+		DrawDataBuffer& operator=( const DrawDataBuffer& ) = delete;
+
+		// Writer side
+		DrawDataSnapshot& getWriteSnapshot();
+		void publish();
+
+		// Reader side. Returns true if a new snapshot was published since the last call.
+		bool acquire();
+		DrawDataSnapshot& getReadSnapshot();
+
+		// Frame of the oldest snapshot the reader can still render : the acquired one, or the published one. INT_MAX if none.
+		// Frame resources (draw callback data) older than it can be released by the writer.
+		int getOldestFrame() const;
+
+		std::size_t getMemoryUsage() const;
+
+	private:
+		DrawDataSnapshot snapshots[3];
+		DrawDataSnapshot* writeSnapshot;
+		DrawDataSnapshot* readySnapshot;
+		DrawDataSnapshot* readSnapshot;
+		bool hasNewSnapshot = false;
+		mutable std::mutex swapMutex; // Only guards pointer swaps, never held while copying or rendering
+	};
+}
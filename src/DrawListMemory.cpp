@@ -0,0 +1,125 @@
+#include "DrawListMemory.h"
+
+#include "imgui_internal.h" // ImGuiContext : windows, viewports, tables
+
+#include <algorithm>
+#include <cstring>
+
+namespace ofxImGui
+{
+	namespace
+	{
+		// Reallocates to a smaller capacity, keeping the content (the draw data can still be read after the update)
+		template<typename T>
+		void shrink(ImVector<T>& buffer, int capacity){
+			T* data = capacity > 0 ? (T*)IM_ALLOC((std::size_t)capacity * sizeof(T)) : nullptr;
+			if(buffer.Size > 0) std::memcpy((void*)data, (const void*)buffer.Data, (std::size_t)buffer.Size * sizeof(T));
+			IM_FREE(buffer.Data);
+			buffer.Data = data;
+			buffer.Capacity = capacity;
+		}
+	}
+
+	//--------------------------------------------------------------
+	template<typename T>
+	void DrawListMemory::updateBuffer(ImVector<T>& buffer, double time, int frame, bool trimNow){
+		auto inserted = buffers.emplace((const void*)&buffer, BufferState());
+		BufferState& state = inserted.first->second;
+		if(inserted.second || trimNow){
+			state.windowPeak = state.lastWindowPeak = buffer.Size;
+			state.reachedTime = trimNow ? time - settings.trimDelay : time;
+		}
+		state.frame = frame;
+		state.windowPeak = std::max(state.windowPeak, buffer.Size);
+
+		const int peak = std::max(state.windowPeak, state.lastWindowPeak);
+		const int retained = peak + (int)(peak * settings.headroom);
+		if(settings.enabled){
+			if(buffer.Capacity <= retained){
+				state.reachedTime = time;
+				if(buffer.Capacity < retained){
+					buffer.reserve(retained);
+					++totals.numReserves;
+				}
+			}
+			else if(time - state.reachedTime >= settings.trimDelay && (std::size_t)(buffer.Capacity - retained) * sizeof(T) >= settings.minTrimBytes){
+				totals.trimmedBytes += (std::size_t)(buffer.Capacity - retained) * sizeof(T);
+				++totals.numTrims;
+				shrink(buffer, retained);
+				state.reachedTime = time;
+			}
+		}
+
+		++totals.numBuffers;
+		totals.usedBytes += (std::size_t)buffer.Size * sizeof(T);
+		totals.peakBytes += (std::size_t)peak * sizeof(T);
+		totals.capacityBytes += (std::size_t)buffer.Capacity * sizeof(T);
+	}
+
+	//--------------------------------------------------------------
+	void DrawListMemory::updateDrawList(ImDrawList* drawList, double time, int frame, bool trimNow){
+		if(drawList == nullptr) return;
+		++totals.numDrawLists;
+		updateBuffer(drawList->VtxBuffer, time, frame, trimNow);
+		updateBuffer(drawList->IdxBuffer, time, frame, trimNow);
+		updateBuffer(drawList->CmdBuffer, time, frame, trimNow);
+		updateSplitter(drawList->_Splitter, time, frame, trimNow);
+	}
+
+	//--------------------------------------------------------------
+	void DrawListMemory::updateSplitter(ImDrawListSplitter& splitter, double time, int frame, bool trimNow){
+		// Channels keep the memory of the columns and layers drawn with the splitter.
+		// The first one is a stale copy of the draw list buffers (swapped when merged), not owning memory.
+		for(int i = 1; i < splitter._Channels.Size; ++i){
+			updateBuffer(splitter._Channels[i]._IdxBuffer, time, frame, trimNow);
+			updateBuffer(splitter._Channels[i]._CmdBuffer, time, frame, trimNow);
+		}
+	}
+
+	//--------------------------------------------------------------
+	void DrawListMemory::update(){
+		ImGuiContext* context = ImGui::GetCurrentContext();
+		if(context == nullptr) return;
+		const double time = ImGui::GetTime();
+		const int frame = ImGui::GetFrameCount();
+		const bool trimNow = trimRequested && settings.enabled;
+		trimRequested = false;
+
+		// Remembers the previous window only
+		if(frame - windowStart >= settings.windowFrames || frame < windowStart){
+			for(auto& buffer : buffers){
+				buffer.second.lastWindowPeak = buffer.second.windowPeak;
+				buffer.second.windowPeak = 0;
+			}
+			windowStart = frame;
+		}
+
+		const std::size_t trimmedBytes = totals.trimmedBytes;
+		const int numTrims = totals.numTrims;
+		const int numReserves = totals.numReserves;
+		totals = Totals();
+		totals.trimmedBytes = trimmedBytes;
+		totals.numTrims = numTrims;
+		totals.numReserves = numReserves;
+
+		// Hidden windows are compacted by ImGui
+		for(ImGuiWindow* window : context->Windows){
+			if(window->Active) updateDrawList(window->DrawList, time, frame, trimNow);
+		}
+		for(ImGuiViewportP* viewport : context->Viewports){
+			updateDrawList(viewport->BgFgDrawLists[0], time, frame, trimNow);
+			updateDrawList(viewport->BgFgDrawLists[1], time, frame, trimNow);
+		}
+		// Splitters of the tables drawn this frame (shared by the tables of a nesting level)
+		for(ImGuiTableTempData& tableData : context->TablesTempData){
+			if(tableData.LastTimeActive < (float)time) continue;
+			updateSplitter(tableData.DrawSplitter, time, frame, trimNow);
+		}
+
+		// Forgets the destroyed and hidden buffers
+		for(auto it = buffers.begin(); it != buffers.end();){
+			if(it->second.frame != frame) it = buffers.erase(it);
+			else ++it;
+		}
+	}
+}
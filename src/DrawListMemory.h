@@ -0,0 +1,76 @@
+#pragma once
+
+#include "imgui.h" // ImVector
+
+#include <cstddef>
+#include <unordered_map>
+
+// Retention policy of the draw list buffers (vertices, indices, commands, splitter channels) of a context, one per ofxImGuiContext.
+// ImGui grows these buffers to their peak and never shrinks them : a huge table opened once keeps its memory for the rest of the run.
+// - The high water mark of each buffer is tracked over a window of frames (the last 1 to 2 windows are remembered).
+// - Buffers allocated above their retained size (high water mark + headroom) for trimDelay seconds are reallocated to it.
+// - Buffers below their retained size are reserved to it : UIs oscillating in size don't reallocate by growth steps.
+// - Gui updates it once a frame was rendered (the content is kept, reallocations are done outside of the frame).
+//   Windows that weren't drawn are left to ImGui's own garbage collection (io.ConfigMemoryCompactTimer).
+// Usage :
+//   gui.getDrawListMemory()->getSettings().trimDelay = 30; // Seconds
+//   ofLogNotice() << gui.getDrawListMemory()->getTotals().capacityBytes / 1024 << " KB allocated by the draw lists";
+
+namespace ofxImGui
+{
+	class DrawListMemory
+	{
+	public:
+		struct Settings
+		{
+			bool enabled = true;
+			int windowFrames = 300;      // Frames of a high water mark window
+			float trimDelay = 10.0f;     // Seconds a buffer stays above its retained size before it's trimmed
+			float headroom = 0.25f;      // Retained size above the high water mark, as a fraction of it
+			std::size_t minTrimBytes = 16 * 1024; // Smaller excesses aren't worth a reallocation
+		};
+
+		// Of the last update
+		struct Totals
+		{
+			int numDrawLists = 0;
+			int numBuffers = 0;
+			std::size_t usedBytes = 0;     // Content of the last frame
+			std::size_t peakBytes = 0;     // Sum of the high water marks
+			std::size_t capacityBytes = 0; // Allocated
+			// Since setup
+			std::size_t trimmedBytes = 0;
+			int numTrims = 0;
+			int numReserves = 0;
+		};
+
+		// Applies the policy to the draw lists of the current ImGui context. Called by Gui after rendering.
+		void update();
+		// Trims all buffers to their last frame size (+ headroom) on the next update, without waiting for trimDelay
+		void requestTrim() { trimRequested = true; }
+
+		Settings& getSettings() { return settings; }
+		const Settings& getSettings() const { return settings; }
+		const Totals& getTotals() const { return totals; }
+
+	private:
+		struct BufferState
+		{
+			int windowPeak = 0;     // High water mark of the current window, in elements
+			int lastWindowPeak = 0; // Of the previous window
+			double reachedTime = 0; // Last time the capacity was within the retained size
+			int frame = 0;          // Last update the buffer was seen
+		};
+
+		template<typename T>
+		void updateBuffer(ImVector<T>& buffer, double time, int frame, bool trimNow);
+		void updateDrawList(ImDrawList* drawList, double time, int frame, bool trimNow);
+		void updateSplitter(ImDrawListSplitter& splitter, double time, int frame, bool trimNow);
+
+		Settings settings;
+		Totals totals;
+		std::unordered_map<const void*, BufferState> buffers; // By ImVector address
+		int windowStart = 0; // Frame
+		bool trimRequested = false;
+	};
+}
@@ -0,0 +1,210 @@
+#include "DrawListShapes.h"
+
+#include "imgui_internal.h" // ImDrawListSharedData::TexUvWhitePixel
+#include "ofLog.h"
+
+#include <algorithm>
+#include <climits>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+	#include <xmmintrin.h>
+	#define OFXIMGUI_DRAW_LIST_SHAPES_SSE
+#endif
+
+namespace ofxImGui
+{
+	namespace
+	{
+		// Reused between calls
+		thread_local ImVector<ImVec2> screenPoints;
+		thread_local ImVector<ImU32> vertexColors;
+		thread_local std::vector<ofIndexType> triangleIndices;
+
+		// With 16 bits indices, a batch can't address more than 64k vertices
+		const int maxPolylinePoints = sizeof(ImDrawIdx) == 2 ? 8192 : INT_MAX;
+		const int maxMeshVertices = sizeof(ImDrawIdx) == 2 ? 0xFFFF : INT_MAX;
+
+		inline ImU32 toU32(const ofColor& color){
+			return IM_COL32(color.r, color.g, color.b, color.a);
+		}
+
+		// Keeps the points further than tolerance from the previous kept point, and the last point. Returns the number of kept points.
+		int decimate(ImVec2* points, int count, float tolerance){
+			if(tolerance <= 0 || count < 3) return count;
+			const float tolerance2 = tolerance * tolerance;
+			int kept = 1;
+			for(int i = 1; i < count - 1; ++i){
+				const float dx = points[i].x - points[kept - 1].x;
+				const float dy = points[i].y - points[kept - 1].y;
+				if(dx * dx + dy * dy >= tolerance2) points[kept++] = points[i];
+			}
+			points[kept++] = points[count - 1];
+			return kept;
+		}
+
+		// points needs room for one more point when closed
+		void addPolylinePoints(ImDrawList* drawList, ImVec2* points, int count, ImU32 color, float thickness, bool closed){
+			if(count <= maxPolylinePoints){
+				drawList->AddPolyline(points, count, color, closed ? ImDrawFlags_Closed : ImDrawFlags_None, thickness);
+				return;
+			}
+			if(closed){
+				points[count++] = points[0];
+			}
+			// Consecutive batches share a point
+			for(int first = 0; first < count - 1; first += maxPolylinePoints - 1){
+				drawList->AddPolyline(points + first, std::min(maxPolylinePoints, count - first), color, ImDrawFlags_None, thickness);
+			}
+		}
+
+		void addTriangles(ImDrawList* drawList, const ImVec2* positions, int numVertices, const ofIndexType* indices, std::size_t numIndices, const ImU32* colors, ImU32 color){
+			numIndices -= numIndices % 3;
+			if(numIndices == 0 || numVertices == 0) return;
+			const ImVec2 uv = drawList->_Data->TexUvWhitePixel;
+
+			if(numVertices <= maxMeshVertices){
+				// All vertices and indices at once
+				drawList->PrimReserve((int)numIndices, numVertices);
+				ImDrawVert* vertex = drawList->_VtxWritePtr;
+				for(int i = 0; i < numVertices; ++i, ++vertex){
+					vertex->pos = positions[i];
+					vertex->uv = uv;
+					vertex->col = colors ? colors[i] : color;
+				}
+				const unsigned int base = drawList->_VtxCurrentIdx;
+				ImDrawIdx* index = drawList->_IdxWritePtr;
+				for(std::size_t i = 0; i < numIndices; ++i){
+					index[i] = (ImDrawIdx)(base + (indices[i] < (ofIndexType)numVertices ? indices[i] : 0));
+				}
+				drawList->_VtxWritePtr += numVertices;
+				drawList->_IdxWritePtr += numIndices;
+				drawList->_VtxCurrentIdx += numVertices;
+				return;
+			}
+
+			// Too many vertices for 16 bits indices : unindexed batches of triangles
+			const std::size_t maxBatchIndices = (maxMeshVertices / 3) * 3;
+			for(std::size_t first = 0; first < numIndices; first += maxBatchIndices){
+				const int count = (int)std::min(maxBatchIndices, numIndices - first);
+				drawList->PrimReserve(count, count);
+				const unsigned int base = drawList->_VtxCurrentIdx;
+				for(int i = 0; i < count; ++i){
+					const ofIndexType source = indices[first + i] < (ofIndexType)numVertices ? indices[first + i] : 0;
+					drawList->_VtxWritePtr[i].pos = positions[source];
+					drawList->_VtxWritePtr[i].uv = uv;
+					drawList->_VtxWritePtr[i].col = colors ? colors[source] : color;
+					drawList->_IdxWritePtr[i] = (ImDrawIdx)(base + i);
+				}
+				drawList->_VtxWritePtr += count;
+				drawList->_IdxWritePtr += count;
+				drawList->_VtxCurrentIdx += count;
+			}
+		}
+	}
+
+	//--------------------------------------------------------------
+	void TransformPoints(const glm::vec3* points, std::size_t count, const DrawTransform& transform, ImVec2* screenPoints){
+		std::size_t i = 0;
+#ifdef OFXIMGUI_DRAW_LIST_SHAPES_SSE
+		if(sizeof(glm::vec3) == 3 * sizeof(float)){
+			// 4 points (12 floats) per iteration : deinterleave x and y, then scale and offset 2 points per register
+			const __m128 scale = _mm_setr_ps(transform.scale.x, transform.scale.y, transform.scale.x, transform.scale.y);
+			const __m128 offset = _mm_setr_ps(transform.offset.x, transform.offset.y, transform.offset.x, transform.offset.y);
+			const float* source = &points[0].x;
+			float* destination = &screenPoints[0].x;
+			for(; i + 4 <= count; i += 4, source += 12, destination += 8){
+				const __m128 v0 = _mm_loadu_ps(source);     // x0 y0 z0 x1
+				const __m128 v1 = _mm_loadu_ps(source + 4); // y1 z1 x2 y2
+				const __m128 v2 = _mm_loadu_ps(source + 8); // z2 x3 y3 z3
+				const __m128 x1y1 = _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(0, 0, 3, 3)); // x1 x1 y1 y1
+				const __m128 p01 = _mm_shuffle_ps(v0, x1y1, _MM_SHUFFLE(2, 0, 1, 0)); // x0 y0 x1 y1
+				const __m128 p23 = _mm_shuffle_ps(v1, v2, _MM_SHUFFLE(2, 1, 3, 2)); // x2 y2 x3 y3
+				_mm_storeu_ps(destination, _mm_add_ps(_mm_mul_ps(p01, scale), offset));
+				_mm_storeu_ps(destination + 4, _mm_add_ps(_mm_mul_ps(p23, scale), offset));
+			}
+		}
+#endif
+		for(; i < count; ++i){
+			screenPoints[i] = ImVec2(points[i].x * transform.scale.x + transform.offset.x, points[i].y * transform.scale.y + transform.offset.y);
+		}
+	}
+
+	//--------------------------------------------------------------
+	void AddPolyline(ImDrawList* drawList, const ofPolyline& polyline, ImU32 color, float thickness, const DrawTransform& transform, float tolerance){
+		const std::vector<glm::vec3>& vertices = polyline.getVertices();
+		if(vertices.size() < 2) return;
+		screenPoints.resize((int)vertices.size() + 1); // Room for closing batched polylines
+		TransformPoints(vertices.data(), vertices.size(), transform, screenPoints.Data);
+		const int count = decimate(screenPoints.Data, (int)vertices.size(), tolerance);
+		addPolylinePoints(drawList, screenPoints.Data, count, color, thickness, polyline.isClosed());
+	}
+
+	//--------------------------------------------------------------
+	void AddMesh(ImDrawList* drawList, const ofMesh& mesh, ImU32 color, const DrawTransform& transform){
+		const std::vector<glm::vec3>& vertices = mesh.getVertices();
+		if(vertices.size() < 3) return;
+		if(vertices.size() > (std::size_t)INT_MAX){
+			ofLogWarning("ofxImGui::AddMesh()") << "Too many vertices.";
+			return;
+		}
+
+		// Triangle indices
+		const std::vector<ofIndexType>& meshIndices = mesh.getIndices();
+		const bool indexed = !meshIndices.empty();
+		const std::size_t count = indexed ? meshIndices.size() : vertices.size();
+		const ofIndexType* indices = meshIndices.data();
+		std::size_t numIndices = count;
+		auto getIndex = [&](std::size_t i){ return indexed ? meshIndices[i] : (ofIndexType)i; };
+		switch(mesh.getMode()){
+			case OF_PRIMITIVE_TRIANGLES:
+				if(!indexed){
+					triangleIndices.resize(count);
+					for(std::size_t i = 0; i < count; ++i) triangleIndices[i] = (ofIndexType)i;
+					indices = triangleIndices.data();
+				}
+				break;
+			case OF_PRIMITIVE_TRIANGLE_STRIP:
+			case OF_PRIMITIVE_TRIANGLE_FAN: {
+				const bool fan = mesh.getMode() == OF_PRIMITIVE_TRIANGLE_FAN;
+				triangleIndices.resize(count < 3 ? 0 : (count - 2) * 3);
+				for(std::size_t i = 2, j = 0; i < count; ++i, j += 3){
+					triangleIndices[j] = getIndex(fan ? 0 : i - 2);
+					triangleIndices[j + 1] = getIndex(i - 1);
+					triangleIndices[j + 2] = getIndex(i);
+				}
+				indices = triangleIndices.data();
+				numIndices = triangleIndices.size();
+				break;
+			}
+			default:
+				ofLogWarning("ofxImGui::AddMesh()") << "Only triangles, triangle strips and triangle fans are supported.";
+				return;
+		}
+
+		screenPoints.resize((int)vertices.size());
+		TransformPoints(vertices.data(), vertices.size(), transform, screenPoints.Data);
+
+		const std::vector<ofFloatColor>& meshColors = mesh.getColors();
+		const bool hasColors = meshColors.size() >= vertices.size();
+		if(hasColors){
+			vertexColors.resize((int)vertices.size());
+			for(std::size_t i = 0; i < vertices.size(); ++i){
+				vertexColors[(int)i] = ImGui::ColorConvertFloat4ToU32(ImVec4(meshColors[i].r, meshColors[i].g, meshColors[i].b, meshColors[i].a));
+			}
+		}
+		addTriangles(drawList, screenPoints.Data, (int)vertices.size(), indices, numIndices, hasColors ? vertexColors.Data : nullptr, color);
+	}
+
+	//--------------------------------------------------------------
+	void AddPath(ImDrawList* drawList, const ofPath& path, const DrawTransform& transform, float tolerance){
+		if(path.isFilled()){
+			AddMesh(drawList, path.getTessellation(), toU32(path.getFillColor()), transform);
+		}
+		if(path.hasOutline()){
+			const ImU32 strokeColor = toU32(path.getStrokeColor());
+			for(const ofPolyline& outline : path.getOutline()){
+				AddPolyline(drawList, outline, strokeColor, path.getStrokeWidth(), transform, tolerance);
+			}
+		}
+	}
+}
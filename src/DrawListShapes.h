@@ -0,0 +1,41 @@
+#pragma once
+
+#include "ofPolyline.h"
+#include "ofPath.h"
+#include "ofMesh.h"
+#include "imgui.h"
+
+// Draws openFrameworks geometry into ImGui draw lists (canvases, previews...), in one batch per shape instead of an AddLine() per segment.
+// - Vertices are transformed to screen coordinates 4 at a time (SSE when available), into a buffer reused between calls.
+// - Polylines are decimated in screen space : points closer than the tolerance to the previous kept point are skipped,
+//   so a 100k points polyline drawn on 500 pixels only submits a few thousand points. Then drawn with a single ImDrawList::AddPolyline().
+// - Meshes (and ofPath fills, from their tessellation) reserve all their vertices and indices at once (ImDrawList::PrimReserve()).
+// - With 16 bits indices (OpenGL ES), shapes are split to stay under 64k vertices per batch.
+// Usage :
+//   ImDrawList* drawList = ImGui::GetWindowDrawList();
+//   ofxImGui::DrawTransform transform(ImGui::GetCursorScreenPos(), ImVec2(zoom, zoom)); // Canvas origin and scale
+//   ofxImGui::AddPolyline(drawList, polyline, IM_COL32_WHITE, 1.0f, transform);
+//   ofxImGui::AddPath(drawList, path, transform);
+
+namespace ofxImGui
+{
+	// OF coordinates to screen coordinates : screen = point * scale + offset
+	struct DrawTransform
+	{
+		DrawTransform(){}
+		DrawTransform(const ImVec2& _offset, const ImVec2& _scale = ImVec2(1, 1)) : offset(_offset), scale(_scale){}
+
+		ImVec2 offset = ImVec2(0, 0);
+		ImVec2 scale = ImVec2(1, 1);
+	};
+
+	// Transforms count points (x and y of glm::vec3) into screen coordinates
+	void TransformPoints(const glm::vec3* points, std::size_t count, const DrawTransform& transform, ImVec2* screenPoints);
+
+	// tolerance : decimation distance in pixels, 0 to draw all points
+	void AddPolyline(ImDrawList* drawList, const ofPolyline& polyline, ImU32 color, float thickness = 1.0f, const DrawTransform& transform = DrawTransform(), float tolerance = 0.5f);
+	// Triangles, triangle strips and fans, with the mesh colors if it has some
+	void AddMesh(ImDrawList* drawList, const ofMesh& mesh, ImU32 color = IM_COL32_WHITE, const DrawTransform& transform = DrawTransform());
+	// Tessellated fill and outlines, with the path colors and stroke width
+	void AddPath(ImDrawList* drawList, const ofPath& path, const DrawTransform& transform = DrawTransform(), float tolerance = 0.5f);
+}
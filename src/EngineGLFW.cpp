@@ -132,6 +132,9 @@ namespace ofxImGui
 //#endif
 		unregisterCallbacks();
 
+        gpuTimer.exit();
+        viewportGpuTimers.clear();
+
         if (ofIsGLProgrammableRenderer()){
             //ImGui_ImplOpenGL3_DestroyFontsTexture(); // called by function below
             //ImGui_ImplOpenGL3_DestroyDeviceObjects(); // Called below
@@ -171,7 +174,37 @@ namespace ofxImGui
 	//--------------------------------------------------------------
     void EngineGLFW::render()
 	{
+        {
+            FrameProfiler::Scope scope(profiler, FrameProfiler::EngineRender);
+            bool gpuTimed = beginGpuTimer();
+            renderDrawData(ImGui::GetDrawData());
+            if(gpuTimed) endGpuTimer();
+        }
+        updatePlatformWindows();
+    }
+
+	//--------------------------------------------------------------
+    void EngineGLFW::updateTextures(ImDrawData* drawData)
+	{
+#if IMGUI_VERSION_NUM >= 19200
+        if (drawData == nullptr || drawData->Textures == nullptr) return;
+        for (ImTextureData* tex : *drawData->Textures){
+            if (tex->Status == ImTextureStatus_OK) continue;
+            if (ofIsGLProgrammableRenderer()) {
+                ImGui_ImplOpenGL3_UpdateTexture(tex);
+            }
+			#if !defined(TARGET_OPENGLES)
+            else {
+                ImGui_ImplOpenGL2_UpdateTexture(tex);
+            }
+			#endif
+        }
+#endif
+    }
 
+	//--------------------------------------------------------------
+    void EngineGLFW::renderDrawData(ImDrawData* drawData)
+	{
 		// Ensure GL is in a compatible state
 #if IMGUI_VERSION_NUM <= 19210 && IMGUI_VERSION_NUM >= 19200
 		// Note: required for ofApps that use ofTexture which can set/leave this to a different value.
@@ -180,7 +213,7 @@ namespace ofxImGui
 #endif
 
         if (ofIsGLProgrammableRenderer()) {
-            ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+            ImGui_ImplOpenGL3_RenderDrawData(drawData);
         }
         else {
 			#if !defined(TARGET_OPENGLES)
@@ -189,11 +222,10 @@ namespace ofxImGui
             // glUseProgram(0);
             //There are potentially many more states you could need to clear/setup that we can't access from default headers.
             //e.g. glBindBuffer(GL_ARRAY_BUFFER, 0), glDisable(GL_TEXTURE_CUBE_MAP).
-            ImGui_ImplOpenGL2_RenderDrawData(ImGui::GetDrawData());
+            ImGui_ImplOpenGL2_RenderDrawData(drawData);
             //glUseProgram(last_program);
 			#endif
         }
-        updatePlatformWindows();
     }
 
     //--------------------------------------------------------------
@@ -201,16 +233,63 @@ namespace ofxImGui
         // Handle multi-viewports
         ImGuiIO& io = ImGui::GetIO();
         if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable){
+            FrameProfiler::Scope scope(profiler, FrameProfiler::PlatformWindows);
             GLFWwindow* backup_current_context = glfwGetCurrentContext(); // Tocheck, maybe not possible on rpi ?
 
             ImGui::UpdatePlatformWindows();
-            ImGui::RenderPlatformWindowsDefault();
+            if(profiler && profiler->isGpuTimingEnabled() && GpuTimer::isSupported()){
+                renderPlatformWindowsTimed();
+            }
+            else {
+                ImGui::RenderPlatformWindowsDefault();
+            }
 
             // Restore context so we can continue to render with oF
             glfwMakeContextCurrent(backup_current_context);
         }
 	}
 
+    //--------------------------------------------------------------
+    // Same as ImGui::RenderPlatformWindowsDefault(), with a GPU timer around each viewport.
+    // Each viewport has its own GL context (current after Platform_RenderWindow), so its own queries.
+    void EngineGLFW::renderPlatformWindowsTimed(){
+        ImGuiPlatformIO& platform_io = ImGui::GetPlatformIO();
+        float gpuMs = 0.f;
+        bool hasGpuResult = false;
+        for (int i = 1; i < platform_io.Viewports.Size; i++){
+            ImGuiViewport* viewport = platform_io.Viewports[i];
+            if (viewport->Flags & ImGuiViewportFlags_IsMinimized)
+                continue;
+            if (platform_io.Platform_RenderWindow) platform_io.Platform_RenderWindow(viewport, nullptr);
+
+            GpuTimer& timer = viewportGpuTimers[viewport->ID];
+            float ms, lastMs = -1.f;
+            while(timer.poll(ms)) lastMs = ms;
+            if(lastMs >= 0.f){
+                gpuMs += lastMs;
+                hasGpuResult = true;
+            }
+
+            bool gpuTimed = timer.begin();
+            if (platform_io.Renderer_RenderWindow) platform_io.Renderer_RenderWindow(viewport, nullptr);
+            if(gpuTimed) timer.end();
+        }
+        for (int i = 1; i < platform_io.Viewports.Size; i++){
+            ImGuiViewport* viewport = platform_io.Viewports[i];
+            if (viewport->Flags & ImGuiViewportFlags_IsMinimized)
+                continue;
+            if (platform_io.Platform_SwapBuffers) platform_io.Platform_SwapBuffers(viewport, nullptr);
+            if (platform_io.Renderer_SwapBuffers) platform_io.Renderer_SwapBuffers(viewport, nullptr);
+        }
+        if(hasGpuResult) profiler->addGpuSample(FrameProfiler::PlatformWindows, gpuMs);
+
+        // Forget closed viewports. Their queries were released with their GL context.
+        for(auto it = viewportGpuTimers.begin(); it != viewportGpuTimers.end();){
+            if(ImGui::FindViewportByID(it->first) == nullptr) it = viewportGpuTimers.erase(it);
+            else ++it;
+        }
+    }
+
 	//--------------------------------------------------------------
     bool EngineGLFW::updateFontsTexture(){
 #if IMGUI_VERSION_NUM < 19200
@@ -18,6 +18,7 @@ struct GLFWwindow;
 //struct GLFWwindow;
 
 #include "GLFW/glfw3.h"
+#include <unordered_map>
 #include "LinkedList.hpp"
 
 struct GlfwCallbacks {
@@ -58,7 +59,11 @@ namespace ofxImGui
 
         void newFrame() override;
         void render() override;
-        void updatePlatformWindows(); // Not recommended to call manually
+        void updateTextures(ImDrawData* drawData) override;
+        void renderDrawData(ImDrawData* drawData) override;
+        void updatePlatformWindows() override; // Not recommended to call manually
+        void renderPlatformWindowsTimed();
+        std::unordered_map<ImGuiID, GpuTimer> viewportGpuTimers; // One per viewport (GL context)
 
         bool updateFontsTexture() override;
 
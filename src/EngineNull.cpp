@@ -0,0 +1,111 @@
+#include "ofxImGuiConstants.h"
+#include "EngineNull.h"
+
+#ifdef OFXIMGUI_BACKEND_NULL
+
+#include "ofAppBaseWindow.h"
+
+namespace ofxImGui
+{
+	//--------------------------------------------------------------
+	void EngineNull::setup(ofAppBaseWindow* _window, ImGuiContext* _imguiContext, bool /*autoDraw*/)
+	{
+		// Store a reference to the current imgui context
+		imguiContext = _imguiContext;
+		window = _window;
+
+		ImGuiIO& io = ImGui::GetIO();
+		io.DisplaySize = window ? ImVec2( window->getWindowSize() ) : ImVec2(1024, 768);
+		io.DeltaTime = 1.0f / 60.0f;
+
+		// Backend name & capabilities
+		io.BackendPlatformName = "imgui_impl_ofximgui_null";
+		io.BackendRendererName = "imgui_impl_ofximgui_null";
+		io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;
+#if IMGUI_VERSION_NUM >= 19200
+		io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures;
+#endif
+
+		// We're done :)
+		isSetup = true;
+	}
+
+	//--------------------------------------------------------------
+	void EngineNull::exit()
+	{
+		if (!isSetup) return;
+
+		// Release textures, as a renderer would do
+		if(setImGuiContext()){
+#if IMGUI_VERSION_NUM >= 19200
+			for (ImTextureData* tex : ImGui::GetPlatformIO().Textures){
+				if (tex->RefCount == 1){
+					tex->SetTexID(ImTextureID_Invalid);
+					tex->SetStatus(ImTextureStatus_Destroyed);
+				}
+			}
+#endif
+			ImGuiIO& io = ImGui::GetIO();
+			io.BackendPlatformName = nullptr;
+			io.BackendRendererName = nullptr;
+			io.BackendFlags = ImGuiBackendFlags_None;
+			restoreImGuiContext();
+		}
+
+		imguiContext = nullptr;
+		window = nullptr;
+		isSetup = false;
+	}
+
+	//--------------------------------------------------------------
+	void EngineNull::newFrame()
+	{
+		ImGuiIO& io = ImGui::GetIO();
+		if(window) io.DisplaySize = ImVec2( window->getWindowSize() );
+		io.DisplayFramebufferScale = ImVec2(1, 1);
+		io.DeltaTime = 1.0f / 60.0f;
+	}
+
+	//--------------------------------------------------------------
+	void EngineNull::render()
+	{
+		FrameProfiler::Scope scope(profiler, FrameProfiler::EngineRender);
+		ImDrawData* drawData = ImGui::GetDrawData();
+		updateTextures(drawData);
+		renderDrawData(drawData);
+	}
+
+	//--------------------------------------------------------------
+	void EngineNull::updateTextures(ImDrawData* drawData)
+	{
+#if IMGUI_VERSION_NUM >= 19200
+		if( drawData == nullptr || drawData->Textures == nullptr ) return;
+		for( ImTextureData* tex : *drawData->Textures ){
+			if( tex->Status == ImTextureStatus_WantCreate ){
+				tex->SetTexID(nextTextureID++);
+				tex->SetStatus(ImTextureStatus_OK);
+			}
+			else if( tex->Status == ImTextureStatus_WantUpdates ){
+				tex->SetStatus(ImTextureStatus_OK);
+			}
+			else if( tex->Status == ImTextureStatus_WantDestroy && tex->UnusedFrames > 0 ){
+				tex->SetTexID(ImTextureID_Invalid);
+				tex->SetStatus(ImTextureStatus_Destroyed);
+			}
+		}
+#endif
+	}
+
+	//--------------------------------------------------------------
+	void EngineNull::renderDrawData(ImDrawData* /*drawData*/)
+	{
+		// Nothing to draw to
+	}
+
+	//--------------------------------------------------------------
+	bool EngineNull::updateFontsTexture(){
+		return true;
+	}
+}
+
+#endif
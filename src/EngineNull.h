@@ -0,0 +1,42 @@
+#pragma once
+
+#include "ofConstants.h"
+
+#include "BaseEngine.h"
+
+#include "ofEvents.h"
+#include "imgui.h"
+
+// A headless engine : no input, no rendering.
+// ImGui builds complete frames (draw lists included), the draw data is simply not submitted to any GPU.
+// Useful for benchmarks and tests running with an ofAppNoWindow, select it with OFXIMGUI_FORCE_NULL_BACKEND.
+// - The display size follows the window size, the frame time is fixed to 1/60s so runs are deterministic.
+// - Textures (font atlas) are marked as uploaded without any GPU memory.
+
+namespace ofxImGui
+{
+	class EngineNull
+		: public BaseEngine
+	{
+	public:
+		~EngineNull()
+		{
+			exit();
+		}
+
+		// BaseEngine required
+		void setup(ofAppBaseWindow* _window, ImGuiContext* imguiContext, bool autoDraw) override;
+		void exit() override;
+
+		void newFrame() override;
+		void render() override;
+		void updateTextures(ImDrawData* drawData) override;
+		void renderDrawData(ImDrawData* drawData) override;
+
+		bool updateFontsTexture() override;
+
+	protected:
+		ofAppBaseWindow* window = nullptr;
+		ImTextureID nextTextureID = 1;
+	};
+}
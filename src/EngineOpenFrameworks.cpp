@@ -96,6 +96,7 @@ namespace ofxImGui
 		unregisterListeners();
 
 		// Clear GPU data
+		gpuTimer.exit();
 		if (ofIsGLProgrammableRenderer()){
 			ImGui_ImplOpenGL3_Shutdown();
 		} else {
@@ -135,7 +136,34 @@ namespace ofxImGui
 	void EngineOpenFrameworks::render()
 	{
 		// Need to set context here too ?
+		FrameProfiler::Scope scope(profiler, FrameProfiler::EngineRender);
+		bool gpuTimed = beginGpuTimer();
+		renderDrawData( ImGui::GetDrawData() );
+		if( gpuTimed ) endGpuTimer();
+	}
 
+	//--------------------------------------------------------------
+	void EngineOpenFrameworks::updateTextures(ImDrawData* drawData)
+	{
+#if IMGUI_VERSION_NUM >= 19200
+		if( drawData == nullptr || drawData->Textures == nullptr ) return;
+		for( ImTextureData* tex : *drawData->Textures ){
+			if( tex->Status == ImTextureStatus_OK ) continue;
+			if (ofIsGLProgrammableRenderer()){
+				ImGui_ImplOpenGL3_UpdateTexture( tex );
+			}
+#if !defined( TARGET_OPENGLES )
+			else {
+				ImGui_ImplOpenGL2_UpdateTexture( tex );
+			}
+#endif
+		}
+#endif
+	}
+
+	//--------------------------------------------------------------
+	void EngineOpenFrameworks::renderDrawData(ImDrawData* drawData)
+	{
 		// Ensure GL is in a compatible state
 #if IMGUI_VERSION_NUM <= 19210 && IMGUI_VERSION_NUM >= 19200
 		// Note: required for ofApps that use ofTexture which can set/leave this to a different value.
@@ -145,10 +173,10 @@ namespace ofxImGui
 
 		// Draw !
 		if (ofIsGLProgrammableRenderer()){
-			ImGui_ImplOpenGL3_RenderDrawData( ImGui::GetDrawData() );
+			ImGui_ImplOpenGL3_RenderDrawData( drawData );
 		} else {
 #if !defined( TARGET_OPENGLES )
-			ImGui_ImplOpenGL2_RenderDrawData( ImGui::GetDrawData() );
+			ImGui_ImplOpenGL2_RenderDrawData( drawData );
 #endif
 		}
 
@@ -72,6 +72,8 @@ namespace ofxImGui
 
         void newFrame() override;
         void render() override;
+        void updateTextures(ImDrawData* drawData) override;
+        void renderDrawData(ImDrawData* drawData) override;
 
         bool updateFontsTexture() override;
 
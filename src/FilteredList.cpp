@@ -0,0 +1,161 @@
+#include "FilteredList.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cstring>
+
+namespace ofxImGui
+{
+	namespace
+	{
+		void toLower(char* text, std::size_t length){
+			// ASCII only, UTF-8 sequences are kept as is
+			for(char* end = text + length; text != end; ++text){
+				if(*text >= 'A' && *text <= 'Z') *text = (char)(*text - 'A' + 'a');
+			}
+		}
+
+		const int maxVisibleItems = 12; // In the combo popup
+	}
+
+	//--------------------------------------------------------------
+	bool FilteredList::combo(const char* label, int* currentIndex, const ListItems& items, ImGuiComboFlags flags){
+		const char* preview = (*currentIndex >= 0 && *currentIndex < items.count) ? items[*currentIndex] : "";
+		if(!ImGui::BeginCombo(label, preview, flags | ImGuiComboFlags_HeightLargest)){
+			return false;
+		}
+		if(ImGui::IsWindowAppearing()){
+			ImGui::SetKeyboardFocusHere();
+		}
+		bool changed = drawFilter(currentIndex, items);
+
+		// The filter box stays visible : items scroll in a child window
+		const int numVisible = std::min(std::max(getNumMatches(), 1), maxVisibleItems);
+		if(ImGui::BeginChild("##Items", ImVec2(0, ImGui::GetTextLineHeightWithSpacing() * numVisible))){
+			changed |= drawItems(currentIndex, items);
+		}
+		ImGui::EndChild();
+		if(changed){
+			ImGui::CloseCurrentPopup();
+		}
+		ImGui::EndCombo();
+		return changed;
+	}
+
+	//--------------------------------------------------------------
+	bool FilteredList::listBox(const char* label, int* currentIndex, const ListItems& items, int heightInItems){
+		ImGui::PushID(label);
+		bool changed = drawFilter(currentIndex, items);
+		ImGui::PopID();
+
+		ImVec2 size(0, 0);
+		if(heightInItems > 0){
+			size.y = ImGui::GetTextLineHeightWithSpacing() * heightInItems + ImGui::GetStyle().FramePadding.y * 2.0f;
+		}
+		if(ImGui::BeginListBox(label, size)){
+			changed |= drawItems(currentIndex, items);
+			ImGui::EndListBox();
+		}
+		return changed;
+	}
+
+	//--------------------------------------------------------------
+	bool FilteredList::drawFilter(int* currentIndex, const ListItems& items){
+		ImGui::SetNextItemWidth(-FLT_MIN);
+		const bool entered = ImGui::InputTextWithHint("##Filter", "Filter", filterBuffer, sizeof(filterBuffer), ImGuiInputTextFlags_EnterReturnsTrue);
+		update(items);
+		if(entered && filtered && !matches.empty()){
+			*currentIndex = matches[0];
+			return true;
+		}
+		return false;
+	}
+
+	//--------------------------------------------------------------
+	bool FilteredList::drawItems(int* currentIndex, const ListItems& items){
+		bool changed = false;
+		ImGuiListClipper clipper;
+		clipper.Begin(getNumMatches());
+		while(clipper.Step()){
+			for(int match = clipper.DisplayStart; match < clipper.DisplayEnd; ++match){
+				const int item = getMatch(match);
+				const bool selected = (item == *currentIndex);
+				ImGui::PushID(item);
+				if(ImGui::Selectable(items[item], selected)){
+					*currentIndex = item;
+					changed = true;
+				}
+				ImGui::PopID();
+			}
+		}
+		return changed;
+	}
+
+	//--------------------------------------------------------------
+	void FilteredList::setFilter(const std::string& filter){
+		std::size_t length = filter.size() < sizeof(filterBuffer) - 1 ? filter.size() : sizeof(filterBuffer) - 1;
+		filter.copy(filterBuffer, length);
+		filterBuffer[length] = '\0';
+	}
+
+	//--------------------------------------------------------------
+	void FilteredList::invalidate(){
+		isDirty = true;
+	}
+
+	//--------------------------------------------------------------
+	void FilteredList::update(const ListItems& items){
+		const int count = items.count > 0 ? items.count : 0;
+		if(isDirty || (const void*)items.getter != indexedGetter || items.userData != indexedUserData || count != indexedCount || items.version != indexedVersion){
+			index.clear();
+			offsets.resize(count);
+			for(int item = 0; item < count; ++item){
+				const char* text = items[item];
+				const std::size_t length = std::strlen(text);
+				offsets[item] = (int)index.size();
+				index.insert(index.end(), text, text + length + 1);
+			}
+			toLower(index.data(), index.size());
+			indexedGetter = (const void*)items.getter;
+			indexedUserData = items.userData;
+			indexedCount = count;
+			indexedVersion = items.version;
+			isDirty = false;
+			query.clear();
+			filtered = false;
+		}
+
+		std::string filter = filterBuffer;
+		toLower(&filter[0], filter.size());
+		if(filter == query && (filtered || filter.empty())) return;
+
+		// Longer query containing the previous one : its matches are within the previous matches
+		const bool refine = filtered && !query.empty() && filter.find(query) != std::string::npos;
+		query = std::move(filter);
+		if(query.empty()){
+			filtered = false;
+			matches.clear();
+			return;
+		}
+		search(refine);
+	}
+
+	//--------------------------------------------------------------
+	void FilteredList::search(bool refine){
+		const char* text = query.c_str();
+		if(refine){
+			std::size_t kept = 0;
+			for(int item : matches){
+				if(std::strstr(index.data() + offsets[item], text)) matches[kept++] = item;
+			}
+			matches.resize(kept);
+		}
+		else {
+			matches.clear();
+			for(int item = 0; item < indexedCount; ++item){
+				if(std::strstr(index.data() + offsets[item], text)) matches.push_back(item);
+			}
+		}
+		filtered = true;
+	}
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "ImHelpers.h"
+
+#include <string>
+#include <vector>
+
+// Combo and list box with a type-to-filter box, for lists of many items (file libraries...).
+// - Items are read through ListItems (getter, count, version) : nothing is copied per frame.
+// - A lowercase copy of the items is indexed once, and again when the getter, user data, count or version change.
+// - Matches are cached until the query or the items change. A query extending the previous one only filters the previous matches.
+// - Only the visible matches are drawn (ImGuiListClipper). Enter picks the first match.
+// Usage :
+//   ofxImGui::FilteredList fileList; // Member of your ofApp, one per widget
+//   In draw() : if(fileList.combo("File", &fileIndex, ofxImGui::ListItems(fileNames, fileNamesVersion))){ ... }
+
+namespace ofxImGui
+{
+	class FilteredList
+	{
+	public:
+		bool combo(const char* label, int* currentIndex, const ListItems& items, ImGuiComboFlags flags = 0);
+		bool listBox(const char* label, int* currentIndex, const ListItems& items, int heightInItems = -1);
+
+		void setFilter(const std::string& filter);
+		std::string getFilter() const { return filterBuffer; }
+		// Updates the index and the matches of the current filter, done by combo() and listBox()
+		void update(const ListItems& items);
+		void invalidate();
+
+		bool isFiltered() const { return filtered; }
+		int getNumMatches() const { return filtered ? (int)matches.size() : indexedCount; }
+		int getMatch(int match) const { return filtered ? matches[match] : match; } // Item index
+
+	private:
+		bool drawFilter(int* currentIndex, const ListItems& items);
+		bool drawItems(int* currentIndex, const ListItems& items);
+		void search(bool refine);
+
+		std::vector<char> index;  // Lowercase items, null terminated
+		std::vector<int> offsets; // Per item, in index
+		std::vector<int> matches; // Item indexes, when filtered
+		const void* indexedGetter = nullptr;
+		const void* indexedUserData = nullptr;
+		int indexedCount = 0;
+		unsigned int indexedVersion = 0;
+		char filterBuffer[128] = "";
+		std::string query; // Lowercase filter of the matches
+		bool filtered = false;
+		bool isDirty = true;
+	};
+}
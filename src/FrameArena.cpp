@@ -0,0 +1,136 @@
+#include "FrameArena.h"
+
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+
+namespace ofxImGui
+{
+	static thread_local FrameArena* currentArena = nullptr;
+
+	//--------------------------------------------------------------
+	FrameArena::FrameArena(std::size_t _blockSize) : blockSize(_blockSize > 0 ? _blockSize : 1024) {
+
+	}
+
+	//--------------------------------------------------------------
+	FrameArena::~FrameArena(){
+		if(currentArena == this) currentArena = nullptr;
+		clear();
+	}
+
+	//--------------------------------------------------------------
+	void FrameArena::addBlock(std::size_t minSize){
+		Block block;
+		block.size = minSize > blockSize ? minSize : blockSize;
+		block.data = (char*)IM_ALLOC(block.size);
+		blocks.push_back(block);
+	}
+
+	//--------------------------------------------------------------
+	void* FrameArena::allocate(std::size_t size, std::size_t alignment){
+		while(true){
+			if(blockIndex < blocks.Size){
+				std::size_t aligned = (offset + alignment - 1) & ~(alignment - 1);
+				if(aligned + size <= blocks[blockIndex].size){
+					offset = aligned + size;
+					usedBytes += size;
+					if(usedBytes > highWaterMark) highWaterMark = usedBytes;
+					return blocks[blockIndex].data + aligned;
+				}
+				// Doesn't fit : continue in the next block
+				if(blockIndex + 1 < blocks.Size){
+					++blockIndex;
+					offset = 0;
+					continue;
+				}
+			}
+			// Blocks are max_align_t aligned (malloc)
+			addBlock(size);
+			blockIndex = blocks.Size - 1;
+			offset = 0;
+		}
+	}
+
+	//--------------------------------------------------------------
+	const char* FrameArena::copy(const char* str, std::size_t length){
+		char* dest = (char*)allocate(length + 1, 1);
+		std::memcpy(dest, str, length);
+		dest[length] = '\0';
+		return dest;
+	}
+
+	//--------------------------------------------------------------
+	const char* FrameArena::format(const char* fmt, ...){
+		// Try to format in place, in the remaining space of the current block
+		char* dest = nullptr;
+		std::size_t available = 0;
+		if(blockIndex < blocks.Size){
+			dest = blocks[blockIndex].data + offset;
+			available = blocks[blockIndex].size - offset;
+		}
+
+		va_list args;
+		va_start(args, fmt);
+		int length = std::vsnprintf(dest, available, fmt, args);
+		va_end(args);
+		if(length < 0) return "";
+
+		if((std::size_t)length < available){
+			offset += length + 1;
+			usedBytes += length + 1;
+			if(usedBytes > highWaterMark) highWaterMark = usedBytes;
+			return dest;
+		}
+
+		// Didn't fit
+		dest = (char*)allocate(length + 1, 1);
+		va_start(args, fmt);
+		std::vsnprintf(dest, length + 1, fmt, args);
+		va_end(args);
+		return dest;
+	}
+
+	//--------------------------------------------------------------
+	void FrameArena::reset(){
+		// Merge the blocks, so next frames fit in a single one
+		if(blocks.Size > 1){
+			std::size_t capacity = getCapacity();
+			clear();
+			addBlock(capacity);
+		}
+		blockIndex = 0;
+		offset = 0;
+		usedBytes = 0;
+	}
+
+	//--------------------------------------------------------------
+	void FrameArena::clear(){
+		for(Block& block : blocks){
+			IM_FREE(block.data);
+		}
+		blocks.clear();
+		blockIndex = 0;
+		offset = 0;
+		usedBytes = 0;
+	}
+
+	//--------------------------------------------------------------
+	std::size_t FrameArena::getCapacity() const {
+		std::size_t capacity = 0;
+		for(const Block& block : blocks){
+			capacity += block.size;
+		}
+		return capacity;
+	}
+
+	//--------------------------------------------------------------
+	FrameArena* FrameArena::getCurrent(){
+		return currentArena;
+	}
+
+	//--------------------------------------------------------------
+	void FrameArena::setCurrent(FrameArena* arena){
+		currentArena = arena;
+	}
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "imgui.h" // ImVector, IM_FMTARGS
+
+#include <cstddef>
+
+// Bump allocator for the transient strings of the ofxImGui helpers (generated widget labels...), one per context.
+// It's rewound at Gui::begin() : strings are valid until the next frame of the same context begins.
+// Memory blocks are kept between frames and merged once the frame size is known, after a few frames it doesn't allocate anymore.
+// Usage (in a helper) :
+//   FrameArena* arena = FrameArena::getCurrent(); // Null outside of a frame, or when disabled (Gui::setFrameArenaEnabled())
+//   const char* label = arena ? arena->format("%s %d", name, i) : ...;
+
+namespace ofxImGui
+{
+	class FrameArena
+	{
+	public:
+		explicit FrameArena(std::size_t _blockSize = 16 * 1024);
+		~FrameArena();
+
+		// Prevent making copies
+		FrameArena( const FrameArena& ) = delete;
+		FrameArena& operator=( const FrameArena& ) = delete;
+
+		void* allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+		const char* copy(const char* str, std::size_t length); // Null-terminated copy
+		const char* format(const char* fmt, ...) IM_FMTARGS(2);
+
+		void reset(); // Rewinds, invalidating all allocations
+		void clear(); // Frees the memory
+
+		std::size_t getUsedBytes() const { return usedBytes; }
+		std::size_t getHighWaterMark() const { return highWaterMark; }
+		std::size_t getCapacity() const;
+
+		// Arena of the frame being built on the calling thread, set by Gui
+		static FrameArena* getCurrent();
+		static void setCurrent(FrameArena* arena);
+
+	private:
+		struct Block {
+			char* data;
+			std::size_t size;
+		};
+		void addBlock(std::size_t minSize);
+
+		ImVector<Block> blocks; // IM_ALLOC'd, counted by AllocationTracker
+		int blockIndex = 0;     // Current block
+		std::size_t offset = 0; // In the current block
+		std::size_t usedBytes = 0;
+		std::size_t highWaterMark = 0;
+		std::size_t blockSize;
+	};
+}
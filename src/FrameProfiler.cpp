@@ -0,0 +1,102 @@
+#include "FrameProfiler.h"
+
+#include <algorithm>
+
+namespace ofxImGui
+{
+	//--------------------------------------------------------------
+	void FrameProfiler::addSample(Phase phase, float ms){
+		if(!enabled || phase >= NumPhases) return;
+		addSample(phases[phase], ms);
+	}
+
+	//--------------------------------------------------------------
+	void FrameProfiler::addGpuSample(Phase phase, float ms){
+		if(!isGpuTimingEnabled() || phase >= NumPhases) return;
+		addSample(gpuPhases[phase], ms);
+	}
+
+	//--------------------------------------------------------------
+	void FrameProfiler::addSample(PhaseSamples& p, float ms){
+		p.samples[p.next] = ms;
+		p.next = (p.next + 1) % NumSamples;
+		if(p.count < NumSamples) ++p.count;
+	}
+
+	//--------------------------------------------------------------
+	FrameProfiler::Stats FrameProfiler::getStats(Phase phase) const {
+		if(phase >= NumPhases) return Stats();
+		return computeStats(phases[phase]);
+	}
+
+	//--------------------------------------------------------------
+	FrameProfiler::Stats FrameProfiler::getGpuStats(Phase phase) const {
+		if(phase >= NumPhases) return Stats();
+		return computeStats(gpuPhases[phase]);
+	}
+
+	//--------------------------------------------------------------
+	FrameProfiler::Stats FrameProfiler::computeStats(const PhaseSamples& p){
+		Stats stats;
+		if(p.count == 0) return stats;
+
+		// Oldest sample is at next once the ring is full
+		const int first = p.count < NumSamples ? 0 : p.next;
+		float sorted[NumSamples];
+		float sum = 0.f;
+		for(int i = 0; i < p.count; ++i){
+			sorted[i] = p.samples[(first + i) % NumSamples];
+			sum += sorted[i];
+		}
+
+		stats.count = p.count;
+		stats.last = p.samples[(p.next + NumSamples - 1) % NumSamples];
+		stats.avg = sum / p.count;
+		stats.min = *std::min_element(sorted, sorted + p.count);
+
+		int p99Index = (p.count * 99) / 100;
+		if(p99Index >= p.count) p99Index = p.count - 1;
+		std::nth_element(sorted, sorted + p99Index, sorted + p.count);
+		stats.p99 = sorted[p99Index];
+		return stats;
+	}
+
+	//--------------------------------------------------------------
+	const float* FrameProfiler::getSamples(Phase phase, int& count, int& offset) const {
+		if(phase >= NumPhases){
+			count = offset = 0;
+			return nullptr;
+		}
+		const PhaseSamples& p = phases[phase];
+		count = p.count;
+		offset = p.count < NumSamples ? 0 : p.next;
+		return p.samples;
+	}
+
+	//--------------------------------------------------------------
+	const char* FrameProfiler::getPhaseName(Phase phase){
+		switch(phase){
+			case EngineNewFrame:  return "Engine new frame";
+			case NewFrame:        return "ImGui::NewFrame";
+			case UserCode:        return "User code";
+			case EndFrame:        return "ImGui::EndFrame";
+			case Render:          return "ImGui::Render";
+			case EngineRender:    return "Engine render";
+			case PlatformWindows: return "Platform windows";
+			default:              return "Unknown";
+		}
+	}
+
+	//--------------------------------------------------------------
+	void FrameProfiler::reset(){
+		for(PhaseSamples& p : phases){
+			p.next = 0;
+			p.count = 0;
+		}
+		for(PhaseSamples& p : gpuPhases){
+			p.next = 0;
+			p.count = 0;
+		}
+		allocations.reset();
+	}
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <chrono>
+
+#include "AllocationTracker.h"
+
+// Low-overhead per-phase timings of the ofxImGui frame, one profiler per ofxImGuiContext.
+// Each phase keeps a ring of its last samples (one steady_clock pair per measure), statistics are only computed when queried.
+// Engines also record GPU samples (GL_TIME_ELAPSED, see GpuTimer) for EngineRender and PlatformWindows, a few frames late.
+// When AllocationTracker is installed, the ImGui allocations of each phase are counted too (see getAllocations()).
+// Usage :
+//   auto stats = gui.getProfilerStats(ofxImGui::FrameProfiler::Render);
+//   ofLogNotice() << "Render p99 : " << stats.p99 << "ms";
+
+namespace ofxImGui
+{
+	class FrameProfiler
+	{
+	public:
+		enum Phase : unsigned char {
+			EngineNewFrame = 0, // Platform & renderer new frame (input, display size)
+			NewFrame,           // ImGui::NewFrame()
+			UserCode,           // Between gui.begin() and gui.end() : your widgets
+			EndFrame,           // ImGui::EndFrame()
+			Render,             // ImGui::Render() : draw lists finalisation
+			EngineRender,       // GL submission of the draw data
+			PlatformWindows,    // Multi-viewport windows update and rendering (GLFW backend)
+			NumPhases
+		};
+		static_assert(NumPhases <= AllocationTracker::MaxPhases, "AllocationTracker needs more phases");
+
+		static constexpr int NumSamples = 120;
+
+		struct Stats {
+			float last = 0.f; // All in milliseconds
+			float min = 0.f;
+			float avg = 0.f;
+			float p99 = 0.f;
+			int count = 0; // Number of samples used
+		};
+
+		typedef std::chrono::steady_clock Clock;
+
+		// Records one sample
+		void addSample(Phase phase, float ms);
+		void addSample(Phase phase, Clock::time_point start){
+			if(enabled) addSample(phase, std::chrono::duration<float, std::milli>(Clock::now() - start).count());
+		}
+
+		Stats getStats(Phase phase) const;
+		const float* getSamples(Phase phase, int& count, int& offset) const; // For ImGui::PlotLines()
+		static const char* getPhaseName(Phase phase);
+
+		// GPU timings, only recorded by the engines for the phases submitting GL commands
+		void addGpuSample(Phase phase, float ms);
+		Stats getGpuStats(Phase phase) const;
+		void setGpuTimingEnabled(bool _enabled){ gpuEnabled = _enabled; }
+		bool isGpuTimingEnabled() const { return enabled && gpuEnabled; }
+
+		// Allocation counts of each phase (only when AllocationTracker::install() was called)
+		AllocationTracker& getAllocations(){ return allocations; }
+		const AllocationTracker& getAllocations() const { return allocations; }
+
+		void setEnabled(bool _enabled){ enabled = _enabled; }
+		bool isEnabled() const { return enabled; }
+		void reset();
+
+		// Measures a phase until it goes out of scope, also attributing its allocations
+		struct Scope {
+			Scope(FrameProfiler* _profiler, Phase _phase) : profiler(_profiler && _profiler->enabled ? _profiler : nullptr), phase(_phase), allocationScope(_profiler ? &_profiler->allocations : nullptr, _phase) {
+				if(profiler) start = Clock::now();
+			}
+			~Scope(){
+				if(profiler) profiler->addSample(phase, start);
+			}
+			FrameProfiler* profiler;
+			Phase phase;
+			Clock::time_point start;
+			AllocationTracker::Scope allocationScope;
+		};
+
+	private:
+		struct PhaseSamples {
+			float samples[NumSamples] = {};
+			int next = 0;  // Ring write position
+			int count = 0;
+		};
+		static void addSample(PhaseSamples& p, float ms);
+		static Stats computeStats(const PhaseSamples& p);
+
+		PhaseSamples phases[NumPhases];
+		PhaseSamples gpuPhases[NumPhases];
+		AllocationTracker allocations;
+		bool enabled = true;
+		bool gpuEnabled = true;
+	};
+}
@@ -0,0 +1,92 @@
+#include "GpuTimer.h"
+
+#include "ofGLUtils.h" // ofGLCheckExtension
+
+#include <cstdio>
+
+namespace ofxImGui
+{
+	//--------------------------------------------------------------
+	bool GpuTimer::isSupported(){
+#if defined(TARGET_OPENGLES)
+		return false;
+#else
+		static int supported = -1; // Same driver for all windows, check once
+		if(supported < 0){
+			int major = 0, minor = 0;
+			const char* version = (const char*)glGetString(GL_VERSION);
+			if(version) std::sscanf(version, "%d.%d", &major, &minor);
+			supported = (major > 3 || (major == 3 && minor >= 3) || ofGLCheckExtension("GL_ARB_timer_query")) ? 1 : 0;
+		}
+		return supported == 1;
+#endif
+	}
+
+	//--------------------------------------------------------------
+	bool GpuTimer::begin(){
+#if defined(TARGET_OPENGLES)
+		return false;
+#else
+		if(isActive || !isSupported()) return false;
+		if(!isSetup){
+			glGenQueries(NumQueries, queries);
+			isSetup = true;
+		}
+
+		// All queries in flight : skip this measure
+		if(pendingCount >= NumQueries) return false;
+
+		// Don't nest in another timer query
+		GLint currentQuery = 0;
+		glGetQueryiv(GL_TIME_ELAPSED, GL_CURRENT_QUERY, &currentQuery);
+		if(currentQuery != 0) return false;
+
+		glBeginQuery(GL_TIME_ELAPSED, queries[writeIndex]);
+		isActive = true;
+		return true;
+#endif
+	}
+
+	//--------------------------------------------------------------
+	void GpuTimer::end(){
+#if !defined(TARGET_OPENGLES)
+		if(!isActive) return;
+		glEndQuery(GL_TIME_ELAPSED);
+		writeIndex = (writeIndex + 1) % NumQueries;
+		++pendingCount;
+		isActive = false;
+#endif
+	}
+
+	//--------------------------------------------------------------
+	bool GpuTimer::poll(float& ms){
+#if defined(TARGET_OPENGLES)
+		return false;
+#else
+		if(pendingCount == 0) return false;
+		GLuint query = queries[(writeIndex + NumQueries - pendingCount) % NumQueries];
+
+		GLint available = 0;
+		glGetQueryObjectiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+		if(!available) return false;
+
+		GLuint64 elapsedNs = 0;
+		glGetQueryObjectui64v(query, GL_QUERY_RESULT, &elapsedNs);
+		--pendingCount;
+		ms = (float)((double)elapsedNs / 1000000.0);
+		return true;
+#endif
+	}
+
+	//--------------------------------------------------------------
+	void GpuTimer::exit(){
+#if !defined(TARGET_OPENGLES)
+		if(isSetup){
+			if(isActive) glEndQuery(GL_TIME_ELAPSED);
+			glDeleteQueries(NumQueries, queries);
+		}
+#endif
+		isSetup = isActive = false;
+		writeIndex = pendingCount = 0;
+	}
+}
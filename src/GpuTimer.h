@@ -0,0 +1,40 @@
+#pragma once
+
+#include "ofConstants.h" // GL types
+
+// Measures GPU time with GL_TIME_ELAPSED queries, without stalling the pipeline.
+// Queries are kept in a small ring and their results are read once available, a few frames later.
+// When all queries are still pending, the measure is skipped rather than waiting.
+// Notes :
+// - Query objects are not shared between GL contexts : use one timer per context, and call begin/end/poll with it bound.
+// - GL_TIME_ELAPSED queries can't be nested, begin() is skipped while another one is active (e.g. set by your ofApp).
+// - Requires GL 3.3 or ARB_timer_query. Not available on OpenGL ES.
+
+namespace ofxImGui
+{
+	class GpuTimer
+	{
+	public:
+		GpuTimer(){}
+
+		// Prevent making copies
+		GpuTimer( const GpuTimer& ) = delete;
+		GpuTimer& operator=( const GpuTimer& ) = delete;
+
+		bool begin(); // Returns true if a query started, then call end()
+		void end();
+		bool poll(float& ms); // Reads the oldest finished measure, call it until it returns false
+		void exit(); // Deletes the queries, needs the GL context
+
+		static bool isSupported(); // Needs a current GL context
+
+		static constexpr int NumQueries = 4;
+
+	private:
+		GLuint queries[NumQueries] = {};
+		int writeIndex = 0;
+		int pendingCount = 0;
+		bool isSetup = false;
+		bool isActive = false;
+	};
+}
@@ -6,6 +6,9 @@
 #include "ofxImGuiConstants.h"
 #include "imgui_internal.h" // <-- advanced docking features from imgui internals...
 
+#include <algorithm>
+#include <chrono>
+
 //#include "imgui.h"
 //#include "backends/imgui_impl_glfw.h"
 
@@ -204,6 +207,7 @@ namespace ofxImGui
 			io.IniFilename = iniFileName.c_str();
 
 		// Start engines
+		this->context->engine.profiler = &context->profiler;
 		this->context->engine.setup( _ofWindow.get(), context->imguiContext, context->autoDraw);
 
 		// Load a default font
@@ -596,11 +600,28 @@ namespace ofxImGui
 					userWasWarned = true;
 				}
 			}
+			else {
+				// Next shared instance : its widgets are user code too
+				context->userCodeStart = FrameProfiler::Clock::now();
+				FrameArena::setCurrent(context->frameArenaEnabled ? &context->frameArena : nullptr);
+				DrawFunctionStore::setCurrent(&context->drawFunctions);
+				ParameterCommitQueue::setCurrent(&context->parameterCommits);
+				SearchableGroupStore::setCurrent(&context->searchableGroups);
+				AllocationTracker::setCurrent(&context->profiler.getAllocations(), FrameProfiler::UserCode);
+			}
             return;
         }
 
 		ImGui::SetCurrentContext(context->imguiContext);
 
+		// Close the allocation counts of the previous frame, its transient strings aren't used anymore
+		context->profiler.getAllocations().newFrame();
+		context->frameArena.reset();
+		FrameArena::setCurrent(context->frameArenaEnabled ? &context->frameArena : nullptr);
+		DrawFunctionStore::setCurrent(&context->drawFunctions);
+		ParameterCommitQueue::setCurrent(&context->parameterCommits);
+		SearchableGroupStore::setCurrent(&context->searchableGroups);
+
 #if IMGUI_VERSION_NUM < 19190
         // Help people loading fonts incorrectly
         ImGuiIO& io = ImGui::GetIO();
@@ -609,8 +630,14 @@ namespace ofxImGui
 #endif
 
         //std::cout << "New Frame in context " << context << " in window " << ofGetWindowPtr() << " (" << ofGetWindowPtr()->getWindowSize().x << ")" << std::endl;
-		context->engine.newFrame();
-        ImGui::NewFrame();
+		{
+			FrameProfiler::Scope scope(&context->profiler, FrameProfiler::EngineNewFrame);
+			context->engine.newFrame();
+		}
+		{
+			FrameProfiler::Scope scope(&context->profiler, FrameProfiler::NewFrame);
+			ImGui::NewFrame();
+		}
 
         // Sync IO debug chars
 #ifdef OFXIMGUI_DEBUG
@@ -620,6 +647,9 @@ namespace ofxImGui
 #endif
 
 		context->isRenderingFrame = true;
+		context->userCodeMs = 0.f;
+		context->userCodeStart = FrameProfiler::Clock::now();
+		AllocationTracker::setCurrent(&context->profiler.getAllocations(), FrameProfiler::UserCode);
 	}
 
 	//--------------------------------------------------------------
@@ -632,6 +662,19 @@ namespace ofxImGui
             return;
         }
 
+		// Notify the deferred parameter edits, once the user code is done (also from shared instances)
+		context->parameterCommits.flush();
+
+		// Shared instances add up their user code, recorded once when the frame is rendered
+		if( context->isRenderingFrame ){
+			context->userCodeMs += std::chrono::duration<float, std::milli>(FrameProfiler::Clock::now() - context->userCodeStart).count();
+		}
+		AllocationTracker::setCurrent(nullptr, 0);
+		FrameArena::setCurrent(nullptr);
+		DrawFunctionStore::setCurrent(nullptr);
+		ParameterCommitQueue::setCurrent(nullptr);
+		SearchableGroupStore::setCurrent(nullptr);
+
 		// Let context open in shared mode. (automatically called in the native render function)
 		if( context->isShared()==true ){
 #ifdef OFXIMGUI_DEBUG
@@ -643,6 +686,10 @@ namespace ofxImGui
             return;
         }
 
+		if( context->isRenderingFrame ){
+			context->profiler.addSample(FrameProfiler::UserCode, context->userCodeMs);
+		}
+
         // Update cached variables
         updateDockingVp();
         // Update height
@@ -658,6 +705,7 @@ namespace ofxImGui
 
             // End submitting to ImGui
 			//context->engine.endFrame();
+			FrameProfiler::Scope scope(&context->profiler, FrameProfiler::EndFrame);
             ImGui::EndFrame();
 
             //render(); // Now called after ofApp::draw() using a callback.
@@ -671,6 +719,7 @@ namespace ofxImGui
             }
 
 			//context->engine.endFrame(); // (Does nothing...)
+			FrameProfiler::Scope scope(&context->profiler, FrameProfiler::EndFrame);
             ImGui::EndFrame();
         }
     }
@@ -684,13 +733,142 @@ namespace ofxImGui
         beforeDraw.notify(a);
 
 		ImGui::SetCurrentContext(context->imguiContext);
-        ImGui::Render();
-		context->engine.render();
+		if( context->isShared() && context->isRenderingFrame ){
+			context->profiler.addSample(FrameProfiler::UserCode, context->userCodeMs);
+		}
+		// Deferred mode : only snapshot the frame, renderDeferred() submits it
+		if(context->drawDataBuffer){
+			if(!context->isFrameBuilt){
+				FrameProfiler::Scope scope(&context->profiler, FrameProfiler::Render);
+				ImGui::Render();
+			}
+			// ImGui::Render() is paid in both modes, only time what replaces the GL submission
+			auto start = std::chrono::steady_clock::now();
+			ImDrawData* drawData = ImGui::GetDrawData();
+			context->engine.updateTextures(drawData); // Needs the GL context of the window
+			auto texturesEnd = std::chrono::steady_clock::now();
+			context->drawDataBuffer->getWriteSnapshot().capture(drawData, ImGui::GetFrameCount());
+			context->drawDataBuffer->publish();
+			context->texturesMs = std::chrono::duration<float, std::milli>(texturesEnd - start).count();
+			context->snapshotMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+			context->engine.updatePlatformWindows();
+		}
+		// Scheduled frames already have their draw data
+		else {
+			if(!context->isFrameBuilt){
+				FrameProfiler::Scope scope(&context->profiler, FrameProfiler::Render);
+				ImGui::Render();
+			}
+			context->engine.render();
+		}
+		// The draw lists are rendered, their buffers can be reallocated
+		context->drawListMemory.update();
+		// With deferred rendering, the render thread can draw older frames for as long as it doesn't acquire a new snapshot
+		const int frame = ImGui::GetFrameCount();
+		context->drawFunctions.release(context->drawDataBuffer ? std::min(frame, context->drawDataBuffer->getOldestFrame()) : frame);
+		if(frame % 60 == 0) context->searchableGroups.release(frame);
 		context->isRenderingFrame = false;
+		context->isFrameBuilt = false;
 
         afterDraw.notify(a);
     }
 
+	//--------------------------------------------------------------
+	bool Gui::setDeferredRendering(bool enabled){
+		if(context==nullptr){
+			ofLogWarning("Gui::setDeferredRendering()") << "Context is not set. Please call setup() first !";
+			return false;
+		}
+		if(enabled && (!isContextOwned || context->isShared())){
+			ofLogWarning("Gui::setDeferredRendering()") << "Only non-shared master instances can use deferred rendering.";
+			return false;
+		}
+		if(enabled && !context->drawDataBuffer){
+			context->drawDataBuffer.reset(new DrawDataBuffer());
+		}
+		else if(!enabled){
+			context->drawDataBuffer.reset();
+		}
+		return true;
+	}
+
+	//--------------------------------------------------------------
+	bool Gui::isDeferredRenderingEnabled() const {
+		return context && context->drawDataBuffer;
+	}
+
+	//--------------------------------------------------------------
+	// Note: can be called from another thread, don't touch the Gui state here.
+	bool Gui::renderDeferred(){
+		if(context==nullptr || !context->drawDataBuffer) return false;
+
+		auto start = std::chrono::steady_clock::now();
+		bool isNew = context->drawDataBuffer->acquire();
+		DrawDataSnapshot& snapshot = context->drawDataBuffer->getReadSnapshot();
+		if(!snapshot.isValid()) return false;
+
+		// The backend reads its data from the current context
+		ImGuiContext* prevContext = ImGui::GetCurrentContext();
+		ImGui::SetCurrentContext(context->imguiContext);
+		context->engine.renderDrawData(snapshot.getDrawData());
+		ImGui::SetCurrentContext(prevContext);
+
+		context->submitMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+		return isNew;
+	}
+
+	//--------------------------------------------------------------
+	Gui::DeferredRenderStats Gui::getDeferredRenderStats() const {
+		DeferredRenderStats stats;
+		if(context==nullptr || !context->drawDataBuffer) return stats;
+		stats.snapshotMs = context->snapshotMs;
+		stats.submitMs = context->submitMs;
+		// In place, engine.render() would update the textures then submit the draw data
+		stats.savedMs = context->texturesMs + stats.submitMs - stats.snapshotMs;
+		stats.snapshotBytes = context->drawDataBuffer->getMemoryUsage();
+		return stats;
+	}
+
+	//--------------------------------------------------------------
+	// Like begin(), but only the platform part. ImGui::NewFrame() is called later by the scheduler, on a worker thread.
+	bool Gui::beginScheduledFrame(){
+		if(context==nullptr || context->imguiContext==nullptr){
+			ofLogWarning("Gui::beginScheduledFrame()") << "Context is not set. Please call setup() first !";
+			return false;
+		}
+		if(!isContextOwned || context->isShared()){
+			ofLogWarning("Gui::beginScheduledFrame()") << "Only non-shared master instances can be scheduled.";
+			return false;
+		}
+		if(context->isRenderingFrame){
+			ofLogWarning("Gui::beginScheduledFrame()") << "The frame already began, did you forget to render the previous one ?";
+			return false;
+		}
+
+		ImGui::SetCurrentContext(context->imguiContext);
+		context->profiler.getAllocations().newFrame();
+		FrameProfiler::Scope scope(&context->profiler, FrameProfiler::EngineNewFrame);
+		context->engine.newFrame();
+		return true;
+	}
+
+	//--------------------------------------------------------------
+	void Gui::endScheduledFrame(){
+		ImGui::SetCurrentContext(context->imguiContext);
+
+		// Same as end(), reading the state of the built frame
+		updateDockingVp();
+		ImGuiWindow* menuWin = ImGui::FindWindowByID(ImGui::GetIDWithSeed("##MainMenuBar", nullptr, 0));
+		menuHeight = (menuWin && !menuWin->Hidden && menuWin->Active) ? ImGui::GetFrameHeight() : 0;
+
+		// Notify the deferred parameter edits of the job here : listeners run on the main thread, whichever thread built the frame
+		context->parameterCommits.flush();
+
+		// Ready for render()
+		context->isRenderingFrame = true;
+		context->isFrameBuilt = true;
+	}
+
 	//--------------------------------------------------------------
     void Gui::draw()
 	{
@@ -720,6 +898,58 @@ namespace ofxImGui
         };
     }
 
+	//--------------------------------------------------------------
+	FrameProfiler* Gui::getProfiler(){
+		return context ? &context->profiler : nullptr;
+	}
+
+	//--------------------------------------------------------------
+	const FrameProfiler* Gui::getProfiler() const {
+		return context ? &context->profiler : nullptr;
+	}
+
+	//--------------------------------------------------------------
+	FrameProfiler::Stats Gui::getProfilerStats(FrameProfiler::Phase phase) const {
+		if(context == nullptr) return FrameProfiler::Stats();
+		return context->profiler.getStats(phase);
+	}
+
+	//--------------------------------------------------------------
+	FrameProfiler::Stats Gui::getProfilerGpuStats(FrameProfiler::Phase phase) const {
+		if(context == nullptr) return FrameProfiler::Stats();
+		return context->profiler.getGpuStats(phase);
+	}
+
+	//--------------------------------------------------------------
+	void Gui::setFrameArenaEnabled(bool enabled){
+		if(context == nullptr){
+			ofLogWarning("Gui::setFrameArenaEnabled()") << "Context is not set. Please call setup() first !";
+			return;
+		}
+		context->frameArenaEnabled = enabled;
+		if(!enabled) context->frameArena.clear();
+	}
+
+	//--------------------------------------------------------------
+	bool Gui::isFrameArenaEnabled() const {
+		return context != nullptr && context->frameArenaEnabled;
+	}
+
+	//--------------------------------------------------------------
+	const FrameArena* Gui::getFrameArena() const {
+		return context ? &context->frameArena : nullptr;
+	}
+
+	//--------------------------------------------------------------
+	DrawListMemory* Gui::getDrawListMemory(){
+		return context ? &context->drawListMemory : nullptr;
+	}
+
+	//--------------------------------------------------------------
+	const DrawListMemory* Gui::getDrawListMemory() const {
+		return context ? &context->drawListMemory : nullptr;
+	}
+
 	//--------------------------------------------------------------
 	void Gui::drawOfxImGuiDebugWindow(bool* open) const {
 		// Only provide this functions with debug flags on
@@ -943,6 +1173,122 @@ namespace ofxImGui
 					ImGui::EndTabItem();
 				}
 
+				// PROFILER tab
+				if (ImGui::BeginTabItem("Profiler"))
+				{
+					ImGui::PushStyleColor(ImGuiCol_Text, IM_COL32(200,200,200,200));
+					ImGui::Dummy({10,10});
+					ImGui::TextWrapped("Timings of the ofxImGui frame phases in this context, over the last %i measures.", FrameProfiler::NumSamples);
+					ImGui::PopStyleColor();
+
+					ImGui::Dummy({10,10});
+					bool profilerEnabled = context->profiler.isEnabled();
+					if(ImGui::Checkbox("Enabled", &profilerEnabled)) context->profiler.setEnabled(profilerEnabled);
+					ImGui::SameLine();
+					bool gpuEnabled = context->profiler.isGpuTimingEnabled();
+					if(ImGui::Checkbox("GPU timers", &gpuEnabled)) context->profiler.setGpuTimingEnabled(gpuEnabled);
+					ImGui::SameLine();
+					if(ImGui::Button("Reset")) context->profiler.reset();
+					if(!GpuTimer::isSupported()){
+						ImGui::TextDisabled("GPU timer queries (GL_TIME_ELAPSED) are not supported by this GL context.");
+					}
+
+					if(ImGui::BeginTable("##profilerPhases", 8, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchProp)){
+						ImGui::TableSetupColumn("Phase");
+						ImGui::TableSetupColumn("Last (ms)");
+						ImGui::TableSetupColumn("Min");
+						ImGui::TableSetupColumn("Avg");
+						ImGui::TableSetupColumn("P99");
+						ImGui::TableSetupColumn("GPU avg");
+						ImGui::TableSetupColumn("GPU p99");
+						ImGui::TableSetupColumn("History", ImGuiTableColumnFlags_WidthFixed, 120);
+						ImGui::TableHeadersRow();
+						for(int phase = 0; phase < FrameProfiler::NumPhases; ++phase){
+							FrameProfiler::Stats stats = context->profiler.getStats((FrameProfiler::Phase)phase);
+							ImGui::TableNextRow();
+							ImGui::TableNextColumn(); ImGui::TextUnformatted(FrameProfiler::getPhaseName((FrameProfiler::Phase)phase));
+							if(stats.count == 0){
+								ImGui::TableNextColumn(); ImGui::TextDisabled("-");
+								continue;
+							}
+							ImGui::TableNextColumn(); ImGui::Text("%.3f", stats.last);
+							ImGui::TableNextColumn(); ImGui::Text("%.3f", stats.min);
+							ImGui::TableNextColumn(); ImGui::Text("%.3f", stats.avg);
+							ImGui::TableNextColumn(); ImGui::Text("%.3f", stats.p99);
+							FrameProfiler::Stats gpuStats = context->profiler.getGpuStats((FrameProfiler::Phase)phase);
+							if(gpuStats.count > 0){
+								ImGui::TableNextColumn(); ImGui::Text("%.3f", gpuStats.avg);
+								ImGui::TableNextColumn(); ImGui::Text("%.3f", gpuStats.p99);
+							}
+							else {
+								ImGui::TableNextColumn(); ImGui::TextDisabled("-");
+								ImGui::TableNextColumn(); ImGui::TextDisabled("-");
+							}
+							ImGui::TableNextColumn();
+							int count, offset;
+							const float* samples = context->profiler.getSamples((FrameProfiler::Phase)phase, count, offset);
+							ImGui::PushID(phase);
+							ImGui::PlotLines("##history", samples, count, offset, nullptr, 0.f, FLT_MAX, ImVec2(-1, ImGui::GetTextLineHeight()));
+							ImGui::PopID();
+						}
+						ImGui::EndTable();
+					}
+
+					ImGui::Dummy({10,10});
+					ImGui::SeparatorText("Allocations");
+					if(!AllocationTracker::isInstalled()){
+						ImGui::TextDisabled("Not counted : call ofxImGui::AllocationTracker::install() before gui.setup().");
+					}
+					else if(ImGui::BeginTable("##profilerAllocations", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchProp)){
+						const AllocationTracker& allocations = context->profiler.getAllocations();
+						ImGui::TableSetupColumn("Phase");
+						ImGui::TableSetupColumn("Allocs / frame");
+						ImGui::TableSetupColumn("Frees / frame");
+						ImGui::TableSetupColumn("KB / frame");
+						ImGui::TableSetupColumn("Total allocs");
+						ImGui::TableHeadersRow();
+						for(int phase = 0; phase <= FrameProfiler::NumPhases; ++phase){
+							bool isTotalRow = (phase == FrameProfiler::NumPhases);
+							AllocationTracker::Counters frame = isTotalRow ? allocations.getFrameCounters() : allocations.getFrameCounters(phase);
+							ImGui::TableNextRow();
+							ImGui::TableNextColumn(); ImGui::TextUnformatted(isTotalRow ? "Frame" : FrameProfiler::getPhaseName((FrameProfiler::Phase)phase));
+							ImGui::TableNextColumn(); ImGui::Text("%zu", frame.allocs);
+							ImGui::TableNextColumn(); ImGui::Text("%zu", frame.frees);
+							ImGui::TableNextColumn(); ImGui::Text("%.2f", frame.bytes / 1024.f);
+							ImGui::TableNextColumn();
+							if(isTotalRow) ImGui::TextDisabled("-");
+							else ImGui::Text("%zu", allocations.getTotalCounters(phase).allocs);
+						}
+						ImGui::EndTable();
+						AllocationTracker::Counters untracked = AllocationTracker::getUntrackedCounters();
+						ImGui::TextDisabled("Outside of frames (all contexts) : %zu allocs, %zu frees, %.1f KB.", untracked.allocs, untracked.frees, untracked.bytes / 1024.f);
+					}
+
+					ImGui::Dummy({10,10});
+					ImGui::SeparatorText("Frame arena");
+					bool frameArenaEnabled = context->frameArenaEnabled;
+					if(ImGui::Checkbox("Build helper labels in the frame arena", &frameArenaEnabled)){
+						context->frameArenaEnabled = frameArenaEnabled;
+						if(!frameArenaEnabled) context->frameArena.clear();
+					}
+					ImGui::Text("Used : %.1f KB, high water mark : %.1f KB, capacity : %.1f KB", context->frameArena.getUsedBytes() / 1024.f, context->frameArena.getHighWaterMark() / 1024.f, context->frameArena.getCapacity() / 1024.f);
+
+					ImGui::Dummy({10,10});
+					ImGui::SeparatorText("Draw lists memory");
+					DrawListMemory::Settings& drawListSettings = context->drawListMemory.getSettings();
+					ImGui::Checkbox("Trim and reserve the draw list buffers", &drawListSettings.enabled);
+					ImGui::SetNextItemWidth(ImGui::GetFontSize() * 8);
+					ImGui::DragFloat("Trim delay", &drawListSettings.trimDelay, 0.5f, 0.f, 600.f, "%.1f s");
+					ImGui::SameLine();
+					if(ImGui::Button("Trim now")) context->drawListMemory.requestTrim();
+					const DrawListMemory::Totals& drawListTotals = context->drawListMemory.getTotals();
+					ImGui::Text("%i draw lists, %i buffers", drawListTotals.numDrawLists, drawListTotals.numBuffers);
+					ImGui::Text("Used : %.1f KB, high water mark : %.1f KB, capacity : %.1f KB", drawListTotals.usedBytes / 1024.f, drawListTotals.peakBytes / 1024.f, drawListTotals.capacityBytes / 1024.f);
+					ImGui::TextDisabled("Trimmed : %.1f KB in %i reallocations, %i reserves.", drawListTotals.trimmedBytes / 1024.f, drawListTotals.numTrims, drawListTotals.numReserves);
+
+					ImGui::EndTabItem();
+				}
+
 				// Backend TAB
 				if (ImGui::BeginTabItem("oF Windows"))
 				{
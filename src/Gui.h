@@ -9,14 +9,25 @@
 
 #include <map>
 #include <bitset>
+#include <memory>
+#include <atomic>
 
 #include "ofxImGuiConstants.h"
 #include "DefaultTheme.h"
+#include "DrawDataSnapshot.h"
+#include "FrameProfiler.h"
+#include "FrameArena.h"
+#include "DrawListMemory.h"
+#include "DrawCallbacks.h"
+#include "ParameterCommits.h"
+#include "SearchableGroup.h"
 //#include "LinkedList.hpp"
 #include <unordered_map>
 #include "imgui.h" // for ImFont*
 
-#if defined(OFXIMGUI_BACKEND_OPENFRAMEWORKS)
+#if defined(OFXIMGUI_BACKEND_NULL)
+	#include "EngineNull.h"
+#elif defined(OFXIMGUI_BACKEND_OPENFRAMEWORKS)
 	#include "EngineOpenFrameworks.h"
 #elif defined (OFXIMGUI_BACKEND_VULKAN)
 	#include "EngineVk.h"
@@ -62,7 +73,8 @@ struct ofxImGuiContext {
 			ofWindow(_window),
 			autoDraw(false),
 			slaveCount(0),
-			isRenderingFrame(false){}
+			isRenderingFrame(false),
+			isFrameBuilt(false){}
 	public:
 		// Prevent making copies
 		ofxImGuiContext( const ofxImGuiContext& ) = delete;
@@ -86,6 +98,13 @@ struct ofxImGuiContext {
 		ImGuiContext* imguiContext = nullptr;
 		std::shared_ptr<ofAppBaseWindow> ofWindow;
 		bool autoDraw;
+		ofxImGui::FrameProfiler profiler;
+		ofxImGui::FrameArena frameArena; // Transient strings of the helpers, rewound when a frame begins
+		bool frameArenaEnabled = true;
+		ofxImGui::DrawListMemory drawListMemory; // Draw list buffers retention, updated after rendering
+		ofxImGui::DrawFunctionStore drawFunctions; // Of AddDrawFunction(), released after rendering and with the context
+		ofxImGui::SearchableGroupStore searchableGroups; // Of AddGroupSearchable(), released after rendering and with the context
+		ofxImGui::ParameterCommitQueue parameterCommits; // Deferred parameter notifications, flushed on the main thread when the frame ends
 
 		inline bool isShared() const {
 			return slaveCount > 1;
@@ -101,8 +120,19 @@ struct ofxImGuiContext {
 	protected:
 		unsigned int slaveCount;
 		bool isRenderingFrame;
-
-#if defined (OFXIMGUI_BACKEND_OPENFRAMEWORKS)
+		bool isFrameBuilt; // ImGui::Render() already called (by GuiFrameScheduler), only GL submission is left
+		ofxImGui::FrameProfiler::Clock::time_point userCodeStart; // Set when the frame began, or when a shared instance began
+		float userCodeMs = 0.f; // User code of the frame, summed over the shared instances
+
+		// Deferred rendering : render() publishes a snapshot, renderDeferred() submits it. Null when disabled.
+		std::unique_ptr<ofxImGui::DrawDataBuffer> drawDataBuffer;
+		std::atomic<float> snapshotMs{0.f}; // Main thread : texture updates + copy
+		std::atomic<float> texturesMs{0.f}; // Main thread : texture updates only
+		std::atomic<float> submitMs{0.f};   // Render thread : GL submission of the snapshot
+
+#if defined (OFXIMGUI_BACKEND_NULL)
+		ofxImGui::EngineNull engine;
+#elif defined (OFXIMGUI_BACKEND_OPENFRAMEWORKS)
 		ofxImGui::EngineOpenFrameworks engine;
 #elif defined (OFXIMGUI_BACKEND_VULKAN)
 		ofxImGui::EngineVk engine;
@@ -135,6 +165,8 @@ namespace ofxImGui
 		friend class BaseEngine;
 		friend class EngineGLFW;
 		friend class EngineOpenFrameworks;
+		friend class EngineNull;
+		friend class GuiFrameScheduler;
 	public:
 		Gui();
 		~Gui();
@@ -157,6 +189,24 @@ namespace ofxImGui
 
 		void draw();
 
+		// Deferred rendering : the GL submission of the GUI is moved out of the ofApp's draw.
+		// - The main thread still builds the frame, then keeps a deep copy of the draw data (pooled, no allocations in steady state).
+		// - Call renderDeferred() from the thread that submits your GL commands, it draws the latest snapshot.
+		//   The calling thread needs a GL context sharing objects with the window's one. From another thread than the main one,
+		//   compile with OFXIMGUI_ENABLE_THREADED_CONTEXTS so both threads can have a different current ImGui context.
+		// - Only supported by master instances, in non-shared mode.
+		bool setDeferredRendering(bool enabled);
+		bool isDeferredRenderingEnabled() const;
+		bool renderDeferred(); // Returns false if there's no new snapshot (the previous one is submitted again)
+
+		struct DeferredRenderStats {
+			float snapshotMs = 0.f; // Main thread time spent producing the snapshot (texture updates + copy, ImGui::Render() excluded)
+			float submitMs = 0.f;   // Render thread time spent drawing it
+			float savedMs = 0.f;    // Main thread time saved compared to rendering in place (texture updates + submitMs - snapshotMs)
+			std::size_t snapshotBytes = 0; // Memory held by the snapshot buffers
+		};
+		DeferredRenderStats getDeferredRenderStats() const;
+
         bool setDefaultFont(int indexAtlasFont);
         bool setDefaultFont(ImFont* _atlasFont);
         ImFont* addFont(const std::string & fontPath, float fontSize = 13.0f, const ImFontConfig* _fontConfig = nullptr, const ImWchar* _glyphRanges = nullptr, bool _setAsDefaultFont=false );
@@ -185,6 +235,21 @@ namespace ofxImGui
 		// Helper window to debug ofxImGui specific stuff, and provide some hints on your setup.
 		void drawOfxImGuiDebugWindow(bool* open=nullptr) const;
 
+		// Per-phase frame timings of this gui's context (shared by slave instances).
+		FrameProfiler* getProfiler();
+		const FrameProfiler* getProfiler() const;
+		FrameProfiler::Stats getProfilerStats(FrameProfiler::Phase phase) const;
+		FrameProfiler::Stats getProfilerGpuStats(FrameProfiler::Phase phase) const; // EngineRender and PlatformWindows only
+
+		// Lets the ofxImGui helpers build their transient labels in a per-context arena instead of the heap (enabled by default).
+		void setFrameArenaEnabled(bool enabled);
+		bool isFrameArenaEnabled() const;
+		const FrameArena* getFrameArena() const;
+
+		// Retention policy of the draw list buffers : trims the memory kept from heavier frames, reserves the recent peaks.
+		DrawListMemory* getDrawListMemory();
+		const DrawListMemory* getDrawListMemory() const;
+
 		// Helper to retrieve the current gui-free zone within the ofAppWindow.
 		// Basically returns windowRect - MenuBarSpace - SideDocks
 		ofRectangle getMainWindowViewportRect(bool returnScreenCoords=false, bool removeMenuBar=true, bool removeDockingAreas=true) const;
@@ -200,6 +265,10 @@ namespace ofxImGui
 
     private:
         void render();
+
+		// GuiFrameScheduler helpers, called from the main thread before and after building the frame on a worker.
+		bool beginScheduledFrame();
+		void endScheduledFrame();
 		//static void initialiseForWindow();
 
 //#if defined (OFXIMGUI_FORCE_OF_BACKEND)
@@ -0,0 +1,195 @@
+#include "GuiFrameScheduler.h"
+
+#include "Gui.h"
+#include "ofLog.h"
+
+#include "imgui.h"
+
+#ifdef OFXIMGUI_ENABLE_THREADED_CONTEXTS
+// The thread-local GImGui, see imconfig.h
+thread_local ImGuiContext* ofxImGuiThreadContext = nullptr;
+#endif
+
+namespace ofxImGui
+{
+	//--------------------------------------------------------------
+	GuiFrameScheduler::GuiFrameScheduler(){
+
+	}
+
+	//--------------------------------------------------------------
+	GuiFrameScheduler::~GuiFrameScheduler(){
+		exit();
+	}
+
+	//--------------------------------------------------------------
+	void GuiFrameScheduler::setup(unsigned int numThreads){
+		exit();
+
+#ifdef OFXIMGUI_ENABLE_THREADED_CONTEXTS
+		if(numThreads == 0){
+			unsigned int hw = std::thread::hardware_concurrency();
+			numThreads = hw > 1 ? hw - 1 : 1;
+		}
+
+		bExit = false;
+		workers.reserve(numThreads);
+		for(unsigned int i = 0; i < numThreads; ++i){
+			workers.emplace_back(&GuiFrameScheduler::workerLoop, this);
+		}
+#else
+		(void)numThreads;
+	#ifdef OFXIMGUI_DEBUG
+		ofLogNotice("GuiFrameScheduler::setup()") << "OFXIMGUI_ENABLE_THREADED_CONTEXTS is not set, frames will be built serially on the calling thread.";
+	#endif
+#endif
+	}
+
+	//--------------------------------------------------------------
+	void GuiFrameScheduler::exit(){
+		{
+			std::lock_guard<std::mutex> lock(jobsMutex);
+			bExit = true;
+		}
+		jobsAvailable.notify_all();
+		for(auto& worker : workers){
+			if(worker.joinable()) worker.join();
+		}
+		workers.clear();
+		jobs.clear();
+	}
+
+	//--------------------------------------------------------------
+	bool GuiFrameScheduler::addFrame(Gui& gui, std::function<void()> buildFunc){
+		// Contexts can't be shared between 2 jobs
+		for(const FrameJob& job : jobs){
+			if(job.gui->context == gui.context){
+				ofLogWarning("GuiFrameScheduler::addFrame()") << "This context is already scheduled for this frame, ignoring.";
+				return false;
+			}
+		}
+
+		// Platform frame (input, display size, GL device objects) : main thread only.
+		if(!gui.beginScheduledFrame()){
+			return false;
+		}
+
+		jobs.push_back({ &gui, std::move(buildFunc) });
+		return true;
+	}
+
+	//--------------------------------------------------------------
+	void GuiFrameScheduler::buildFrames(){
+		if(jobs.empty()) return;
+
+		// Remember the main thread's context
+		ImGuiContext* prevContext = ImGui::GetCurrentContext();
+
+		if(workers.empty() || jobs.size() == 1){
+			for(FrameJob& job : jobs){
+				runJob(job);
+			}
+		}
+		else {
+			{
+				std::lock_guard<std::mutex> lock(jobsMutex);
+				nextJob = 0;
+				jobCount = jobs.size();
+				pendingJobs = jobs.size();
+			}
+			jobsAvailable.notify_all();
+
+			// The main thread helps too
+			while(true){
+				std::size_t jobIndex;
+				{
+					std::lock_guard<std::mutex> lock(jobsMutex);
+					if(nextJob >= jobCount) break;
+					jobIndex = nextJob++;
+				}
+				runJob(jobs[jobIndex]);
+				{
+					std::lock_guard<std::mutex> lock(jobsMutex);
+					--pendingJobs;
+				}
+			}
+
+			// Wait for workers to finish
+			std::unique_lock<std::mutex> lock(jobsMutex);
+			jobsDone.wait(lock, [this](){ return pendingJobs == 0; });
+			jobCount = 0;
+		}
+
+		// Back on the main thread : sync the Gui instances
+		for(FrameJob& job : jobs){
+			job.gui->endScheduledFrame();
+		}
+		jobs.clear();
+
+		ImGui::SetCurrentContext(prevContext);
+	}
+
+	//--------------------------------------------------------------
+	unsigned int GuiFrameScheduler::getNumThreads() const {
+		return workers.size();
+	}
+
+	//--------------------------------------------------------------
+	bool GuiFrameScheduler::isThreaded() const {
+		return !workers.empty();
+	}
+
+	//--------------------------------------------------------------
+	void GuiFrameScheduler::runJob(FrameJob& job){
+		ImGui::SetCurrentContext(job.gui->context->imguiContext);
+
+		// Each context is built by one thread only, its profiler and arena can be written here
+		FrameProfiler& profiler = job.gui->context->profiler;
+		FrameArena& frameArena = job.gui->context->frameArena;
+		frameArena.reset();
+		FrameArena::setCurrent(job.gui->context->frameArenaEnabled ? &frameArena : nullptr);
+		DrawFunctionStore::setCurrent(&job.gui->context->drawFunctions);
+		ParameterCommitQueue::setCurrent(&job.gui->context->parameterCommits); // Flushed by endScheduledFrame()
+		SearchableGroupStore::setCurrent(&job.gui->context->searchableGroups);
+		{
+			FrameProfiler::Scope scope(&profiler, FrameProfiler::NewFrame);
+			ImGui::NewFrame();
+		}
+		{
+			FrameProfiler::Scope scope(&profiler, FrameProfiler::UserCode);
+			if(job.buildFunc) job.buildFunc();
+		}
+		{
+			FrameProfiler::Scope scope(&profiler, FrameProfiler::Render);
+			ImGui::Render(); // Also ends the frame
+		}
+		FrameArena::setCurrent(nullptr);
+		DrawFunctionStore::setCurrent(nullptr);
+		ParameterCommitQueue::setCurrent(nullptr);
+		SearchableGroupStore::setCurrent(nullptr);
+	}
+
+	//--------------------------------------------------------------
+	void GuiFrameScheduler::workerLoop(){
+		while(true){
+			std::size_t jobIndex;
+			{
+				std::unique_lock<std::mutex> lock(jobsMutex);
+				jobsAvailable.wait(lock, [this](){
+					return bExit || nextJob < jobCount;
+				});
+				if(bExit) return;
+				jobIndex = nextJob++;
+			}
+
+			runJob(jobs[jobIndex]);
+
+			bool allDone;
+			{
+				std::lock_guard<std::mutex> lock(jobsMutex);
+				allDone = (--pendingJobs == 0);
+			}
+			if(allDone) jobsDone.notify_all();
+		}
+	}
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "ofxImGuiConstants.h"
+
+#include <vector>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+// Builds the frames of several ofxImGui contexts (one per ofAppBaseWindow) in parallel.
+// - Platform input (engine.newFrame()) and GL submission (engine.render()) stay on the main thread, one window after another.
+// - The CPU-side work (ImGui::NewFrame(), your widget code and ImGui::Render()) runs on a small worker pool, one context per job.
+// Requirements :
+// - Compile with OFXIMGUI_ENABLE_THREADED_CONTEXTS so each thread gets its own current ImGui context.
+//   Without it, jobs run serially on the calling thread (same result, no speedup).
+// - Only master instances can be scheduled, each in its own ofAppBaseWindow (one ImGuiContext can't be used by 2 threads).
+// - Your build functions run on worker threads : don't call openFrameworks drawing or GL functions from them.
+// - The ofxImGui helpers (ImHelpers.h) keep their frame state thread_local (unique names, parameter caches), they can be used from jobs.
+//   Anything else shared by several build functions (ofParameters, your data) needs your own synchronisation.
+//   Deferred parameter commits (see ParameterCommits.h) are notified on the main thread, once the jobs are done.
+// Usage :
+//   In setup()  : guiA.setup(windowA); guiB.setup(windowB); scheduler.setup();
+//   In update() : scheduler.addFrame(guiA, [&](){ ImGui::Begin("A"); ... ImGui::End(); });
+//                 scheduler.addFrame(guiB, [&](){ ... });
+//                 scheduler.buildFrames(); // Blocks until all frames are built
+//   Rendering then happens as usual in each window's draw (autoDraw) or with gui.draw().
+
+namespace ofxImGui
+{
+	class Gui;
+
+	class GuiFrameScheduler
+	{
+	public:
+		GuiFrameScheduler();
+		~GuiFrameScheduler();
+
+		// Prevent making copies
+		GuiFrameScheduler( const GuiFrameScheduler& ) = delete;
+		GuiFrameScheduler& operator=( const GuiFrameScheduler& ) = delete;
+
+		// numThreads = 0 uses hardware_concurrency-1 (at least 1)
+		void setup(unsigned int numThreads = 0);
+		void exit();
+
+		// Queue a frame for the next buildFrames() call. buildFunc submits your widgets.
+		bool addFrame(Gui& gui, std::function<void()> buildFunc);
+
+		// Builds all queued frames, blocks until they're done.
+		void buildFrames();
+
+		unsigned int getNumThreads() const;
+		bool isThreaded() const;
+
+	private:
+		struct FrameJob {
+			Gui* gui;
+			std::function<void()> buildFunc;
+		};
+
+		void workerLoop();
+		static void runJob(FrameJob& job);
+
+		std::vector<FrameJob> jobs;
+		std::vector<std::thread> workers;
+
+		// Work distribution
+		std::mutex jobsMutex;
+		std::condition_variable jobsAvailable;
+		std::condition_variable jobsDone;
+		std::size_t nextJob = 0;
+		std::size_t jobCount = 0; // Jobs vector size, only read by workers while building
+		std::size_t pendingJobs = 0;
+		bool bExit = false;
+	};
+}
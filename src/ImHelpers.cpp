@@ -1,4 +1,10 @@
 #include "ImHelpers.h"
+#include "FrameArena.h"
+#include "imgui_internal.h" // ImHashStr, ImFormatString, FindRenderedTextEnd
+
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
 
 //--------------------------------------------------------------
 ofxImGui::Settings::Settings()
@@ -8,6 +14,8 @@ ofxImGui::Settings::Settings()
 	, mouseOverGui(false)
 	, windowBlock(false)
 	, treeLevel(0)
+	, commitPolicy(CommitInherited)
+	, commitInterval(0.1f)
 {}
 
 bool ofxImGui::IsMouseOverGui()
@@ -23,29 +31,215 @@ bool ofxImGui::IsAnyGuiActive()
 	return ImGui::IsAnyItemActive();
 }
 
+//--------------------------------------------------------------
+// Unique names : each scope (window, tree) has an open-addressed set of name hashes with their occurrence counts.
+// Scopes are stacked in a single pool, the current one always being at its end, so it can grow in place.
+// The pool keeps its capacity : after the first frames, no allocations are made anymore.
+namespace
+{
+	struct UniqueNameEntry
+	{
+		ImGuiID hash; // 0 = empty
+		ImU32 count;
+	};
+
+	struct UniqueNameScope
+	{
+		int offset;
+		int capacity; // Power of 2
+		int size;
+	};
+
+	struct UniqueNameState
+	{
+		ImVector<UniqueNameEntry> pool;
+		ImVector<UniqueNameScope> scopes;
+		ImGuiContext* context = nullptr;
+		int frame = -1;
+
+		// Label storage when there's no frame arena
+		static constexpr int NumLabels = 8;
+		ImVector<char> labels[NumLabels];
+		int nextLabel = 0;
+	};
+
+	// Thread-local : contexts can be built in parallel (GuiFrameScheduler)
+	thread_local UniqueNameState uniqueNames;
+
+	//--------------------------------------------------------------
+	// Scopes left open by a previous frame (window-less zones) are dropped
+	void SyncUniqueNames()
+	{
+		ImGuiContext* context = ImGui::GetCurrentContext();
+		int frame = context ? ImGui::GetFrameCount() : -1;
+		if (context != uniqueNames.context || frame != uniqueNames.frame)
+		{
+			uniqueNames.pool.resize(0);
+			uniqueNames.scopes.resize(0);
+			uniqueNames.context = context;
+			uniqueNames.frame = frame;
+		}
+	}
+
+	//--------------------------------------------------------------
+	UniqueNameEntry* FindUniqueName(UniqueNameEntry* entries, int capacity, ImGuiID hash)
+	{
+		// Linear probing
+		int mask = capacity - 1;
+		int i = hash & mask;
+		while (entries[i].hash != 0 && entries[i].hash != hash)
+		{
+			i = (i + 1) & mask;
+		}
+		return &entries[i];
+	}
+
+	//--------------------------------------------------------------
+	// Returns the occurrence number of this name in the current scope, starting at 1
+	ImU32 CountUniqueName(ImGuiID hash)
+	{
+		SyncUniqueNames();
+		if (uniqueNames.scopes.empty())
+		{
+			// Top-level scope in window-less zones. See issue #6.
+			ofxImGui::PushUniqueNameScope();
+		}
+		if (hash == 0) hash = 1;
+
+		UniqueNameScope& scope = uniqueNames.scopes.back();
+		UniqueNameEntry* entry = FindUniqueName(uniqueNames.pool.Data + scope.offset, scope.capacity, hash);
+		if (entry->hash == hash)
+		{
+			return ++entry->count;
+		}
+
+		// Keep the load factor under 1/2 : rehash at the end of the pool, then move it back in place
+		if ((scope.size + 1) * 2 > scope.capacity)
+		{
+			int newCapacity = scope.capacity * 2;
+			int newOffset = uniqueNames.pool.Size;
+			uniqueNames.pool.resize(newOffset + newCapacity, UniqueNameEntry{ 0, 0 });
+			UniqueNameEntry* newEntries = uniqueNames.pool.Data + newOffset;
+			for (int i = scope.offset; i < scope.offset + scope.capacity; ++i)
+			{
+				if (uniqueNames.pool[i].hash != 0)
+				{
+					*FindUniqueName(newEntries, newCapacity, uniqueNames.pool[i].hash) = uniqueNames.pool[i];
+				}
+			}
+			memmove(uniqueNames.pool.Data + scope.offset, newEntries, newCapacity * sizeof(UniqueNameEntry));
+			uniqueNames.pool.resize(scope.offset + newCapacity);
+			scope.capacity = newCapacity;
+			entry = FindUniqueName(uniqueNames.pool.Data + scope.offset, scope.capacity, hash);
+		}
+
+		entry->hash = hash;
+		entry->count = 1;
+		++scope.size;
+		return 1;
+	}
+
+	//--------------------------------------------------------------
+	char* AllocateLabel(std::size_t size)
+	{
+		if (ofxImGui::FrameArena* arena = ofxImGui::FrameArena::getCurrent())
+		{
+			return (char*)arena->allocate(size, 1);
+		}
+		ImVector<char>& label = uniqueNames.labels[uniqueNames.nextLabel];
+		uniqueNames.nextLabel = (uniqueNames.nextLabel + 1) % UniqueNameState::NumLabels;
+		if (label.Size < (int)size) label.resize((int)size);
+		return label.Data;
+	}
+
+	//--------------------------------------------------------------
+	const char* MakeUniqueName(const char* candidate, std::size_t length, bool copy)
+	{
+		ImU32 count = CountUniqueName(ImHashStr(candidate, length));
+		if (count == 1)
+		{
+			if (!copy) return candidate;
+			char* label = AllocateLabel(length + 1);
+			memcpy(label, candidate, length);
+			label[length] = '\0';
+			return label;
+		}
+
+		// Hidden suffix : displays the same, different ID
+		char suffix[16];
+		int suffixLength = ImFormatString(suffix, sizeof(suffix), "##%u", count);
+		char* label = AllocateLabel(length + suffixLength + 1);
+		memcpy(label, candidate, length);
+		memcpy(label + length, suffix, suffixLength + 1);
+		return label;
+	}
+}
+
+//--------------------------------------------------------------
+void ofxImGui::PushUniqueNameScope()
+{
+	SyncUniqueNames();
+	UniqueNameScope scope;
+	scope.offset = uniqueNames.pool.Size;
+	scope.capacity = 16;
+	scope.size = 0;
+	uniqueNames.pool.resize(scope.offset + scope.capacity, UniqueNameEntry{ 0, 0 });
+	uniqueNames.scopes.push_back(scope);
+}
+
+//--------------------------------------------------------------
+void ofxImGui::PopUniqueNameScope()
+{
+	SyncUniqueNames();
+	if (uniqueNames.scopes.empty()) return;
+	uniqueNames.pool.resize(uniqueNames.scopes.back().offset);
+	uniqueNames.scopes.pop_back();
+}
+
 //--------------------------------------------------------------
 const char * ofxImGui::GetUniqueName(ofAbstractParameter& parameter)
 {
-	return GetUniqueName(parameter.getName());
+	// getName() returns a temporary
+	const std::string name = parameter.getName();
+	return MakeUniqueName(name.c_str(), name.size(), true);
 }
 
 //--------------------------------------------------------------
 const char * ofxImGui::GetUniqueName(const std::string& candidate)
 {
-	std::string result = candidate;
-	if( !windowOpen.usedNames.empty() ) {
-		while (std::find(windowOpen.usedNames.top().begin(), windowOpen.usedNames.top().end(), result) != windowOpen.usedNames.top().end())
-		{
-			// Note: Add a space to (invisibly) differenciate the parameter name from another one with the same name
-			result += " ";
-		}
-	}
-	else {
-		// Create top-level stack in window-less zones. See issue #6.
-		windowOpen.usedNames.push(std::vector<std::string>());
+	// Copied : the candidate may be a temporary
+	return MakeUniqueName(candidate.c_str(), candidate.size(), true);
+}
+
+//--------------------------------------------------------------
+const char * ofxImGui::GetUniqueName(const char* candidate)
+{
+	return MakeUniqueName(candidate, strlen(candidate), false);
+}
+
+//--------------------------------------------------------------
+ImGuiID ofxImGui::GetUniqueID(const char* name)
+{
+	ImGuiID hash = ImHashStr(name);
+	ImU32 count = CountUniqueName(hash);
+	return count == 1 ? hash : ImHashData(&count, sizeof(count), hash);
+}
+
+//--------------------------------------------------------------
+void ofxImGui::PushUniqueID(const char* name)
+{
+	ImGui::PushID((int)GetUniqueID(name));
+}
+
+//--------------------------------------------------------------
+const char * ofxImGui::GetIndexedLabel(const std::string& name, std::size_t index, std::string& fallback)
+{
+	if (FrameArena* arena = FrameArena::getCurrent())
+	{
+		return arena->format("%s %zu", name.c_str(), index);
 	}
-	windowOpen.usedNames.top().push_back(result);
-	return windowOpen.usedNames.top().back().c_str();
+	fallback = name + " " + ofToString(index);
+	return fallback.c_str();
 }
 
 //--------------------------------------------------------------
@@ -84,8 +278,8 @@ bool ofxImGui::BeginWindow(const std::string& name, Settings& settings, bool col
 
 	settings.windowBlock = true;
 
-	// Push a new list of names onto the stack.
-	windowOpen.usedNames.push(std::vector<std::string>());
+	// New scope for unique names.
+	PushUniqueNameScope();
 
 	ImGui::SetNextWindowPos(settings.windowPos, settings.lockPosition ? ImGuiCond_Always : ImGuiCond_FirstUseEver);
 	ImGui::SetNextWindowSize(settings.windowSize, ImGuiCond_FirstUseEver);
@@ -104,8 +298,8 @@ bool ofxImGui::BeginWindow(const std::string& name, Settings& settings, ImGuiWin
 
 	settings.windowBlock = true;
 
-	// Push a new list of names onto the stack.
-	windowOpen.usedNames.push(std::vector<std::string>());
+	// New scope for unique names.
+	PushUniqueNameScope();
 
 	ImGui::SetNextWindowPos(settings.windowPos, settings.lockPosition? ImGuiCond_Always : ImGuiCond_FirstUseEver);
 	ImGui::SetNextWindowSize(settings.windowSize, ImGuiCond_FirstUseEver);
@@ -132,8 +326,8 @@ void ofxImGui::EndWindow(Settings& settings)
 	// Unlink the referenced ofParameter.
 	windowOpen.parameter.reset();
 
-	// Clear the list of names from the stack.
-	windowOpen.usedNames.pop();
+	// Close the scope of unique names.
+	PopUniqueNameScope();
 
 	// Include this window's bounds in the total bounds.
 	const auto windowBounds = ofRectangle(settings.windowPos, settings.windowSize.x, settings.windowSize.y);
@@ -170,8 +364,8 @@ bool ofxImGui::BeginTree(const std::string& name, Settings& settings)
 	{
 		settings.treeLevel += 1;
 
-		// Push a new list of names onto the stack.
-		windowOpen.usedNames.push(std::vector<std::string>());
+		// New scope for unique names.
+		PushUniqueNameScope();
 	}
 	return result;
 }
@@ -183,119 +377,162 @@ void ofxImGui::EndTree(Settings& settings)
 	
 	settings.treeLevel = std::max(0, settings.treeLevel - 1);
 
-	// Clear the list of names from the stack.
-	windowOpen.usedNames.pop();
+	// Close the scope of unique names.
+	PopUniqueNameScope();
 }
 
 //--------------------------------------------------------------
-void ofxImGui::AddGroup(ofParameterGroup& group, Settings& settings )
+// Parameter handlers : registered in priority order (last registered first), then resolved once per dynamic type.
+// The resolution cache is thread-local (AddGroup() can run on GuiFrameScheduler threads), and rebuilt when a handler is registered.
+namespace
 {
-	bool prevWindowBlock = settings.windowBlock;
-	if (settings.windowBlock)
+	struct ParameterHandlerEntry
 	{
-		if (!ofxImGui::BeginTree(group, settings))
-		{
-			return;
-		}
-	}
-	else
+		const std::type_info* type;
+		ofxImGui::ParameterHandler handler;
+		std::function<bool(ofAbstractParameter&)> matches;
+	};
+
+	template<typename ParameterType>
+	ParameterHandlerEntry MakeParameterHandler(bool (*addParameter)(ParameterType&))
 	{
-		if (!ofxImGui::BeginWindow(group.getName().c_str(), settings))
-		{
-			ofxImGui::EndWindow(settings);
-			return;
-		}
+		return ParameterHandlerEntry{ &typeid(ParameterType),
+			[addParameter](ofAbstractParameter& parameter, ofxImGui::Settings&){ return addParameter(static_cast<ParameterType&>(parameter)); },
+			[](ofAbstractParameter& parameter){ return dynamic_cast<ParameterType*>(&parameter) != nullptr; } };
 	}
 
-	for (auto parameter : group)
+	struct ParameterHandlers
 	{
-		// Group.
-		auto parameterGroup = std::dynamic_pointer_cast<ofParameterGroup>(parameter);
-		if (parameterGroup)
-		{
-			// Recurse through contents.
-			ofxImGui::AddGroup(*parameterGroup, settings);
-			continue;
-		}
+		std::vector<ParameterHandlerEntry> entries; // Lowest priority first
+		std::mutex mutex;
+		std::atomic<unsigned int> version{ 0 };
 
-		// Parameter, try everything we know how to handle.
-#if OF_VERSION_MINOR >= 10
-		auto parameterVec2f = std::dynamic_pointer_cast<ofParameter<glm::vec2>>(parameter);
-		if (parameterVec2f)
-		{
-			ofxImGui::AddParameter(*parameterVec2f);
-			continue;
-		}
-		auto parameterVec3f = std::dynamic_pointer_cast<ofParameter<glm::vec3>>(parameter);
-		if (parameterVec3f)
+		ParameterHandlers()
 		{
-			ofxImGui::AddParameter(*parameterVec3f);
-			continue;
-		}
-		auto parameterVec4f = std::dynamic_pointer_cast<ofParameter<glm::vec4>>(parameter);
-		if (parameterVec4f)
-		{
-			ofxImGui::AddParameter(*parameterVec4f);
-			continue;
-		}
+			// Same order as the former dynamic_cast chain, groups first
+			add(MakeParameterHandler<ofParameter<void>>([](ofParameter<void>& p){ return ofxImGui::AddParameter(p); }));
+			add(MakeParameterHandler<ofParameter<std::string>>([](ofParameter<std::string>& p){ return ofxImGui::AddParameter(p); }));
+			add(MakeParameterHandler<ofParameter<bool>>([](ofParameter<bool>& p){ return ofxImGui::AddParameter(p); }));
+			add(MakeParameterHandler<ofParameter<int>>([](ofParameter<int>& p){ return ofxImGui::AddParameter(p); }));
+			add(MakeParameterHandler<ofParameter<float>>([](ofParameter<float>& p){ return ofxImGui::AddParameter(p); }));
+			add(MakeParameterHandler<ofParameter<ofColor>>([](ofParameter<ofColor>& p){ return ofxImGui::AddParameter(p); }));
+			add(MakeParameterHandler<ofParameter<ofFloatColor>>([](ofParameter<ofFloatColor>& p){ return ofxImGui::AddParameter(p); }));
+			add(MakeParameterHandler<ofParameter<ofVec4f>>([](ofParameter<ofVec4f>& p){ return ofxImGui::AddParameter(p); }));
+			add(MakeParameterHandler<ofParameter<ofVec3f>>([](ofParameter<ofVec3f>& p){ return ofxImGui::AddParameter(p); }));
+			add(MakeParameterHandler<ofParameter<ofVec2f>>([](ofParameter<ofVec2f>& p){ return ofxImGui::AddParameter(p); }));
+#if OF_VERSION_MINOR >= 10
+			add(MakeParameterHandler<ofParameter<glm::ivec4>>([](ofParameter<glm::ivec4>& p){ return ofxImGui::AddParameter(p); }));
+			add(MakeParameterHandler<ofParameter<glm::ivec3>>([](ofParameter<glm::ivec3>& p){ return ofxImGui::AddParameter(p); }));
+			add(MakeParameterHandler<ofParameter<glm::ivec2>>([](ofParameter<glm::ivec2>& p){ return ofxImGui::AddParameter(p); }));
+			add(MakeParameterHandler<ofParameter<glm::vec4>>([](ofParameter<glm::vec4>& p){ return ofxImGui::AddParameter(p); }));
+			add(MakeParameterHandler<ofParameter<glm::vec3>>([](ofParameter<glm::vec3>& p){ return ofxImGui::AddParameter(p); }));
+			add(MakeParameterHandler<ofParameter<glm::vec2>>([](ofParameter<glm::vec2>& p){ return ofxImGui::AddParameter(p); }));
 #endif
-		auto parameterOfVec2f = std::dynamic_pointer_cast<ofParameter<ofVec2f>>(parameter);
-		if (parameterOfVec2f)
-		{
-			ofxImGui::AddParameter(*parameterOfVec2f);
-			continue;
+			add(ParameterHandlerEntry{ &typeid(ofParameterGroup),
+				[](ofAbstractParameter& parameter, ofxImGui::Settings& settings){ ofxImGui::AddGroup(static_cast<ofParameterGroup&>(parameter), settings); return false; },
+				[](ofAbstractParameter& parameter){ return dynamic_cast<ofParameterGroup*>(&parameter) != nullptr; } });
 		}
-		auto parameterOfVec3f = std::dynamic_pointer_cast<ofParameter<ofVec3f>>(parameter);
-		if (parameterOfVec3f)
-		{
-			ofxImGui::AddParameter(*parameterOfVec3f);
-			continue;
-		}
-		auto parameterOfVec4f = std::dynamic_pointer_cast<ofParameter<ofVec4f>>(parameter);
-		if (parameterOfVec4f)
-		{
-			ofxImGui::AddParameter(*parameterOfVec4f);
-			continue;
-		}
-		auto parameterFloatColor = std::dynamic_pointer_cast<ofParameter<ofFloatColor>>(parameter);
-		if (parameterFloatColor)
+
+		void add(ParameterHandlerEntry entry)
 		{
-			ofxImGui::AddParameter(*parameterFloatColor);
-			continue;
+			std::lock_guard<std::mutex> lock(mutex);
+			entries.push_back(std::move(entry));
+			++version;
 		}
-		auto parameterColor = std::dynamic_pointer_cast<ofParameter<ofColor>>(parameter);
-		if (parameterColor)
+	};
+
+	// Returns the handler index, or -1
+	int ResolveParameterHandler(const std::vector<ParameterHandlerEntry>& entries, ofAbstractParameter& parameter)
+	{
+		const std::type_info& type = typeid(parameter);
+		for (int i = (int)entries.size() - 1; i >= 0; --i)
 		{
-			ofxImGui::AddParameter(*parameterColor);
-			continue;
+			if (*entries[i].type == type) return i;
 		}
-		auto parameterFloat = std::dynamic_pointer_cast<ofParameter<float>>(parameter);
-		if (parameterFloat)
+		// Derived types
+		for (int i = (int)entries.size() - 1; i >= 0; --i)
 		{
-			ofxImGui::AddParameter(*parameterFloat);
-			continue;
+			if (entries[i].matches && entries[i].matches(parameter)) return i;
 		}
-		auto parameterInt = std::dynamic_pointer_cast<ofParameter<int>>(parameter);
-		if (parameterInt)
+		return -1;
+	}
+
+	ParameterHandlers& GetParameterHandlers()
+	{
+		static ParameterHandlers handlers;
+		return handlers;
+	}
+
+	struct ParameterHandlerCache
+	{
+		std::unordered_map<const std::type_info*, int> indices; // Keyed by the (unique) type_info address
+		std::vector<ParameterHandlerEntry> entries; // Thread-local copy
+		unsigned int version = ~0u;
+	};
+	thread_local ParameterHandlerCache parameterHandlerCache;
+}
+
+//--------------------------------------------------------------
+void ofxImGui::RegisterParameterHandler(const std::type_info& type, ParameterHandler handler, std::function<bool(ofAbstractParameter&)> matches)
+{
+	GetParameterHandlers().add(ParameterHandlerEntry{ &type, std::move(handler), std::move(matches) });
+}
+
+//--------------------------------------------------------------
+bool ofxImGui::AddParameter(ofAbstractParameter& parameter, Settings& settings)
+{
+	ParameterHandlers& handlers = GetParameterHandlers();
+	ParameterHandlerCache& cache = parameterHandlerCache;
+	if (cache.version != handlers.version)
+	{
+		std::lock_guard<std::mutex> lock(handlers.mutex);
+		cache.indices.clear();
+		cache.entries = handlers.entries;
+		cache.version = handlers.version;
+	}
+
+	const std::type_info* type = &typeid(parameter);
+	auto it = cache.indices.find(type);
+	if (it == cache.indices.end())
+	{
+		int index = ResolveParameterHandler(cache.entries, parameter);
+		if (index < 0)
 		{
-			ofxImGui::AddParameter(*parameterInt);
-			continue;
+			ofLogWarning(__FUNCTION__) << "Could not create GUI element for parameter " << parameter.getName() << " (type " << type->name() << ")";
 		}
-		auto parameterBool = std::dynamic_pointer_cast<ofParameter<bool>>(parameter);
-		if (parameterBool)
+		it = cache.indices.emplace(type, index).first;
+	}
+	if (it->second < 0) return false;
+
+	return cache.entries[it->second].handler(parameter, settings);
+}
+
+//--------------------------------------------------------------
+void ofxImGui::AddGroup(ofParameterGroup& group, Settings& settings )
+{
+	bool prevWindowBlock = settings.windowBlock;
+	if (settings.windowBlock)
+	{
+		if (!ofxImGui::BeginTree(group, settings))
 		{
-			ofxImGui::AddParameter(*parameterBool);
-			continue;
+			return;
 		}
-		auto parameterString = std::dynamic_pointer_cast<ofParameter<std::string>>(parameter);
-		if (parameterString)
+	}
+	else
+	{
+		if (!ofxImGui::BeginWindow(group.getName().c_str(), settings))
 		{
-			ofxImGui::AddParameter(*parameterString);
-			continue;
+			ofxImGui::EndWindow(settings);
+			return;
 		}
+	}
 
-		ofLogWarning(__FUNCTION__) << "Could not create GUI element for parameter " << parameter->getName();
+	ofxImGui::PushCommitPolicy(settings.commitPolicy, settings.commitInterval);
+	for (auto& parameter : group)
+	{
+		ofxImGui::AddParameter(*parameter, settings);
 	}
+	ofxImGui::PopCommitPolicy();
 
 	if (settings.windowBlock && !prevWindowBlock)
 	{
@@ -315,72 +552,48 @@ void ofxImGui::AddGroup(ofParameterGroup& group, Settings& settings )
 bool ofxImGui::AddParameter(ofParameter<glm::tvec2<int>>& parameter)
 {
 	auto tmpRef = parameter.get();
-	if (ImGui::SliderInt2(GetUniqueName(parameter), glm::value_ptr(tmpRef), parameter.getMin().x, parameter.getMax().x))
-	{
-		parameter.set(tmpRef);
-		return true;
-	}
-	return false;
+	const bool edited = ImGui::SliderInt2(GetUniqueName(parameter), glm::value_ptr(tmpRef), parameter.getMin().x, parameter.getMax().x);
+	return CommitParameter(parameter, tmpRef, edited, ImGui::IsItemDeactivatedAfterEdit());
 }
 
 //--------------------------------------------------------------
 bool ofxImGui::AddParameter(ofParameter<glm::tvec3<int>>& parameter)
 {
 	auto tmpRef = parameter.get();
-	if (ImGui::SliderInt3(GetUniqueName(parameter), glm::value_ptr(tmpRef), parameter.getMin().x, parameter.getMax().x))
-	{
-		parameter.set(tmpRef);
-		return true;
-	}
-	return false;
+	const bool edited = ImGui::SliderInt3(GetUniqueName(parameter), glm::value_ptr(tmpRef), parameter.getMin().x, parameter.getMax().x);
+	return CommitParameter(parameter, tmpRef, edited, ImGui::IsItemDeactivatedAfterEdit());
 }
 
 //--------------------------------------------------------------
 bool ofxImGui::AddParameter(ofParameter<glm::tvec4<int>>& parameter)
 {
 	auto tmpRef = parameter.get();
-	if (ImGui::SliderInt4(GetUniqueName(parameter), glm::value_ptr(tmpRef), parameter.getMin().x, parameter.getMax().x))
-	{
-		parameter.set(tmpRef);
-		return true;
-	}
-	return false;
+	const bool edited = ImGui::SliderInt4(GetUniqueName(parameter), glm::value_ptr(tmpRef), parameter.getMin().x, parameter.getMax().x);
+	return CommitParameter(parameter, tmpRef, edited, ImGui::IsItemDeactivatedAfterEdit());
 }
 
 //--------------------------------------------------------------
 bool ofxImGui::AddParameter(ofParameter<glm::vec2>& parameter)
 {
 	auto tmpRef = parameter.get();
-	if (ImGui::SliderFloat2(GetUniqueName(parameter), glm::value_ptr(tmpRef), parameter.getMin().x, parameter.getMax().x))
-	{
-		parameter.set(tmpRef);
-		return true;
-	}
-	return false;
+	const bool edited = ImGui::SliderFloat2(GetUniqueName(parameter), glm::value_ptr(tmpRef), parameter.getMin().x, parameter.getMax().x);
+	return CommitParameter(parameter, tmpRef, edited, ImGui::IsItemDeactivatedAfterEdit());
 }
 
 //--------------------------------------------------------------
 bool ofxImGui::AddParameter(ofParameter<glm::vec3>& parameter)
 {
 	auto tmpRef = parameter.get();
-	if (ImGui::SliderFloat3(GetUniqueName(parameter), glm::value_ptr(tmpRef), parameter.getMin().x, parameter.getMax().x))
-	{
-		parameter.set(tmpRef);
-		return true;
-	}
-	return false;
+	const bool edited = ImGui::SliderFloat3(GetUniqueName(parameter), glm::value_ptr(tmpRef), parameter.getMin().x, parameter.getMax().x);
+	return CommitParameter(parameter, tmpRef, edited, ImGui::IsItemDeactivatedAfterEdit());
 }
 
 //--------------------------------------------------------------
 bool ofxImGui::AddParameter(ofParameter<glm::vec4>& parameter)
 {
 	auto tmpRef = parameter.get();
-	if (ImGui::SliderFloat4(GetUniqueName(parameter), glm::value_ptr(tmpRef), parameter.getMin().x, parameter.getMax().x))
-	{
-		parameter.set(tmpRef);
-		return true;
-	}
-	return false;
+	const bool edited = ImGui::SliderFloat4(GetUniqueName(parameter), glm::value_ptr(tmpRef), parameter.getMin().x, parameter.getMax().x);
+	return CommitParameter(parameter, tmpRef, edited, ImGui::IsItemDeactivatedAfterEdit());
 }
 
 #endif
@@ -389,36 +602,24 @@ bool ofxImGui::AddParameter(ofParameter<glm::vec4>& parameter)
 bool ofxImGui::AddParameter(ofParameter<ofVec2f>& parameter)
 {
 	auto tmpRef = parameter.get();
-	if (ImGui::SliderFloat2(GetUniqueName(parameter), tmpRef.getPtr(), parameter.getMin().x, parameter.getMax().x))
-	{
-		parameter.set(tmpRef);
-		return true;
-	}
-	return false;
+	const bool edited = ImGui::SliderFloat2(GetUniqueName(parameter), tmpRef.getPtr(), parameter.getMin().x, parameter.getMax().x);
+	return CommitParameter(parameter, tmpRef, edited, ImGui::IsItemDeactivatedAfterEdit());
 }
 
 //--------------------------------------------------------------
 bool ofxImGui::AddParameter(ofParameter<ofVec3f>& parameter)
 {
 	auto tmpRef = parameter.get();
-	if (ImGui::SliderFloat3(GetUniqueName(parameter), tmpRef.getPtr(), parameter.getMin().x, parameter.getMax().x))
-	{
-		parameter.set(tmpRef);
-		return true;
-	}
-	return false;
+	const bool edited = ImGui::SliderFloat3(GetUniqueName(parameter), tmpRef.getPtr(), parameter.getMin().x, parameter.getMax().x);
+	return CommitParameter(parameter, tmpRef, edited, ImGui::IsItemDeactivatedAfterEdit());
 }
 
 //--------------------------------------------------------------
 bool ofxImGui::AddParameter(ofParameter<ofVec4f>& parameter)
 {
 	auto tmpRef = parameter.get();
-	if (ImGui::SliderFloat4(GetUniqueName(parameter), tmpRef.getPtr(), parameter.getMin().x, parameter.getMax().x))
-	{
-		parameter.set(tmpRef);
-		return true;
-	}
-	return false;
+	const bool edited = ImGui::SliderFloat4(GetUniqueName(parameter), tmpRef.getPtr(), parameter.getMin().x, parameter.getMax().x);
+	return CommitParameter(parameter, tmpRef, edited, ImGui::IsItemDeactivatedAfterEdit());
 }
 
 //--------------------------------------------------------------
@@ -497,20 +698,8 @@ bool ofxImGui::ColorPicker4(const char* label, ofColor& color, ImGuiColorEditFla
 bool ofxImGui::AddParameter(ofParameter<ofFloatColor>& parameter, bool alpha)
 {
 	auto tmpRef = parameter.get();
-	if (alpha)
-	{
-		if (ImGui::ColorEdit4(GetUniqueName(parameter), &tmpRef.r))
-		{
-			parameter.set(tmpRef);
-			return true;
-		}
-	}
-	else if (ImGui::ColorEdit3(GetUniqueName(parameter), &tmpRef.r))
-	{
-		parameter.set(tmpRef);
-		return true;
-	}
-	return false;
+	const bool edited = alpha ? ImGui::ColorEdit4(GetUniqueName(parameter), &tmpRef.r) : ImGui::ColorEdit3(GetUniqueName(parameter), &tmpRef.r);
+	return CommitParameter(parameter, tmpRef, edited, ImGui::IsItemDeactivatedAfterEdit());
 }
 
 //--------------------------------------------------------------
@@ -527,20 +716,8 @@ bool ofxImGui::AddParameter(ofParameter<ofColor>& parameter, bool alpha)
 
 	auto tmpRef = c.get();
 
-	if (alpha)
-	{
-		if (ImGui::ColorEdit4(GetUniqueName(parameter), &tmpRef.r))
-		{
-			parameter.set(tmpRef);
-			return true;
-		}
-	}
-	else if (ImGui::ColorEdit3(GetUniqueName(parameter), &tmpRef.r))
-	{
-		parameter.set(tmpRef);
-		return true;
-	}
-	return false;
+	const bool edited = alpha ? ImGui::ColorEdit4(GetUniqueName(parameter), &tmpRef.r) : ImGui::ColorEdit3(GetUniqueName(parameter), &tmpRef.r);
+	return CommitParameter(parameter, tmpRef, edited, ImGui::IsItemDeactivatedAfterEdit());
 }
 
 //--------------------------------------------------------------
@@ -549,20 +726,8 @@ bool ofxImGui::AddParameter(ofParameter<std::string>& parameter, size_t maxChars
 	auto tmpRef = parameter.get();
 	char * cString = new char[maxChars];
 	strcpy(cString, tmpRef.c_str());
-	auto result = false;
-	if (multiline)
-	{
-		if (ImGui::InputTextMultiline(GetUniqueName(parameter), cString, maxChars))
-		{
-			parameter.set(cString);
-			result = true;
-		}
-	}
-	else if (ImGui::InputText(GetUniqueName(parameter), cString, maxChars))
-	{
-		parameter.set(cString);
-		result = true;
-	}
+	const bool edited = multiline ? ImGui::InputTextMultiline(GetUniqueName(parameter), cString, maxChars) : ImGui::InputText(GetUniqueName(parameter), cString, maxChars);
+	auto result = CommitParameter(parameter, cString, edited, ImGui::IsItemDeactivatedAfterEdit());
 	delete[] cString;
 	return result;
 }
@@ -582,7 +747,7 @@ bool ofxImGui::AddParameter(ofParameter<void>& parameter, float width)
 bool ofxImGui::AddRadio(ofParameter<int>& parameter, std::vector<std::string> labels, int columns)
 {
 	auto uniqueName = GetUniqueName(parameter);
-	ImGui::Text("%s", uniqueName);
+	ImGui::TextUnformatted(uniqueName, ImGui::FindRenderedTextEnd(uniqueName));
 	auto result = false;
 	auto tmpRef = parameter.get();
 	ImGui::PushID(uniqueName);
@@ -596,11 +761,7 @@ bool ofxImGui::AddRadio(ofParameter<int>& parameter, std::vector<std::string> la
 		ImGui::Columns(1);
 	}
 	ImGui::PopID();
-	if (result)
-	{
-		parameter.set(tmpRef);
-	}
-	return result;
+	return CommitParameter(parameter, tmpRef, result, result);
 }
 
 //--------------------------------------------------------------
@@ -626,35 +787,23 @@ bool ofxImGui::AddCombo(ofParameter<int>& parameter, std::vector<std::string> la
 
 		ImGui::EndCombo();
 	}
-	if (result)
-	{
-		parameter.set(tmpRef);
-	}
-	return result;
+	return CommitParameter(parameter, tmpRef, result, result);
 }
 
 //--------------------------------------------------------------
 bool ofxImGui::AddStepper(ofParameter<int>& parameter, int step, int stepFast)
 {
 	auto tmpRef = parameter.get();
-	if (ImGui::InputInt(GetUniqueName(parameter), &tmpRef, step, stepFast))
-	{
-		parameter.set(tmpRef);
-		return true;
-	}
-	return false;
+	const bool edited = ImGui::InputInt(GetUniqueName(parameter), &tmpRef, step, stepFast);
+	return CommitParameter(parameter, tmpRef, edited, ImGui::IsItemDeactivatedAfterEdit());
 }
 
 //--------------------------------------------------------------
 bool ofxImGui::AddSlider(ofParameter<float>& parameter, const char* format, bool logarithmic)
 {
 	auto tmpRef = parameter.get();
-	if (ImGui::SliderFloat(GetUniqueName(parameter), (float*)&tmpRef, parameter.getMin(), parameter.getMax(), format, logarithmic? ImGuiSliderFlags_Logarithmic : ImGuiSliderFlags_None))
-	{
-		parameter.set(tmpRef);
-		return true;
-	}
-	return false;
+	const bool edited = ImGui::SliderFloat(GetUniqueName(parameter), (float*)&tmpRef, parameter.getMin(), parameter.getMax(), format, logarithmic? ImGuiSliderFlags_Logarithmic : ImGuiSliderFlags_None);
+	return CommitParameter(parameter, tmpRef, edited, ImGui::IsItemDeactivatedAfterEdit());
 }
 
 //--------------------------------------------------------------
@@ -662,13 +811,10 @@ bool ofxImGui::AddRange(const std::string& name, ofParameter<int>& parameterMin,
 {
 	auto tmpRefMin = parameterMin.get();
 	auto tmpRefMax = parameterMax.get();
-	if (ImGui::DragIntRange2(GetUniqueName(name), &tmpRefMin, &tmpRefMax, speed, parameterMin.getMin(), parameterMax.getMax()))
-	{
-		parameterMin.set(tmpRefMin);
-		parameterMax.set(tmpRefMax);
-		return true;
-	}
-	return false;
+	const bool edited = ImGui::DragIntRange2(GetUniqueName(name), &tmpRefMin, &tmpRefMax, speed, parameterMin.getMin(), parameterMax.getMax());
+	const bool released = ImGui::IsItemDeactivatedAfterEdit();
+	CommitParameter(parameterMin, tmpRefMin, edited, released);
+	return CommitParameter(parameterMax, tmpRefMax, edited, released);
 }
 
 //--------------------------------------------------------------
@@ -676,13 +822,10 @@ bool ofxImGui::AddRange(const std::string& name, ofParameter<float>& parameterMi
 {
 	auto tmpRefMin = parameterMin.get();
 	auto tmpRefMax = parameterMax.get();
-	if (ImGui::DragFloatRange2(GetUniqueName(name), &tmpRefMin, &tmpRefMax, speed, parameterMin.getMin(), parameterMax.getMax()))
-	{
-		parameterMin.set(tmpRefMin);
-		parameterMax.set(tmpRefMax);
-		return true;
-	}
-	return false;
+	const bool edited = ImGui::DragFloatRange2(GetUniqueName(name), &tmpRefMin, &tmpRefMax, speed, parameterMin.getMin(), parameterMax.getMax());
+	const bool released = ImGui::IsItemDeactivatedAfterEdit();
+	CommitParameter(parameterMin, tmpRefMin, edited, released);
+	return CommitParameter(parameterMax, tmpRefMax, edited, released);
 }
 
 #if OF_VERSION_MINOR >= 10
@@ -691,81 +834,51 @@ bool ofxImGui::AddRange(const std::string& name, ofParameter<float>& parameterMi
 bool ofxImGui::AddRange(const std::string& name, ofParameter<glm::vec2>& parameterMin, ofParameter<glm::vec2>& parameterMax, float speed)
 {
 	auto result = false;
+	auto released = false;
 	auto tmpRefMin = parameterMin.get();
 	auto tmpRefMax = parameterMax.get();
-	if (ImGui::DragFloatRange2(GetUniqueName(name + " X"), &tmpRefMin.x, &tmpRefMax.x, speed, parameterMin.getMin().x, parameterMax.getMax().x))
-	{
-		result |= true;
-	}
-	if (ImGui::DragFloatRange2(GetUniqueName(name + " Y"), &tmpRefMin.y, &tmpRefMax.y, speed, parameterMin.getMin().y, parameterMax.getMax().y))
-	{
-		result |= true;
-	}
-	if (result)
-	{
-		parameterMin.set(tmpRefMin);
-		parameterMax.set(tmpRefMax);
-		return true;
-	}
-	return false;
+	result |= ImGui::DragFloatRange2(GetUniqueName(name + " X"), &tmpRefMin.x, &tmpRefMax.x, speed, parameterMin.getMin().x, parameterMax.getMax().x);
+	released |= ImGui::IsItemDeactivatedAfterEdit();
+	result |= ImGui::DragFloatRange2(GetUniqueName(name + " Y"), &tmpRefMin.y, &tmpRefMax.y, speed, parameterMin.getMin().y, parameterMax.getMax().y);
+	released |= ImGui::IsItemDeactivatedAfterEdit();
+	CommitParameter(parameterMin, tmpRefMin, result, released);
+	return CommitParameter(parameterMax, tmpRefMax, result, released);
 }
 
 //--------------------------------------------------------------
 bool ofxImGui::AddRange(const std::string& name, ofParameter<glm::vec3>& parameterMin, ofParameter<glm::vec3>& parameterMax, float speed)
 {
 	auto result = false;
+	auto released = false;
 	auto tmpRefMin = parameterMin.get();
 	auto tmpRefMax = parameterMax.get();
-	if (ImGui::DragFloatRange2(GetUniqueName(name + " X"), &tmpRefMin.x, &tmpRefMax.x, speed, parameterMin.getMin().x, parameterMax.getMax().x))
-	{
-		result |= true;
-	}
-	if (ImGui::DragFloatRange2(GetUniqueName(name + " Y"), &tmpRefMin.y, &tmpRefMax.y, speed, parameterMin.getMin().y, parameterMax.getMax().y))
-	{
-		result |= true;
-	}
-	if (ImGui::DragFloatRange2(GetUniqueName(name + " Z"), &tmpRefMin.z, &tmpRefMax.z, speed, parameterMin.getMin().z, parameterMax.getMax().z))
-	{
-		result |= true;
-	}
-	if (result)
-	{
-		parameterMin.set(tmpRefMin);
-		parameterMax.set(tmpRefMax);
-		return true;
-	}
-	return false;
+	result |= ImGui::DragFloatRange2(GetUniqueName(name + " X"), &tmpRefMin.x, &tmpRefMax.x, speed, parameterMin.getMin().x, parameterMax.getMax().x);
+	released |= ImGui::IsItemDeactivatedAfterEdit();
+	result |= ImGui::DragFloatRange2(GetUniqueName(name + " Y"), &tmpRefMin.y, &tmpRefMax.y, speed, parameterMin.getMin().y, parameterMax.getMax().y);
+	released |= ImGui::IsItemDeactivatedAfterEdit();
+	result |= ImGui::DragFloatRange2(GetUniqueName(name + " Z"), &tmpRefMin.z, &tmpRefMax.z, speed, parameterMin.getMin().z, parameterMax.getMax().z);
+	released |= ImGui::IsItemDeactivatedAfterEdit();
+	CommitParameter(parameterMin, tmpRefMin, result, released);
+	return CommitParameter(parameterMax, tmpRefMax, result, released);
 }
 
 //--------------------------------------------------------------
 bool ofxImGui::AddRange(const std::string& name, ofParameter<glm::vec4>& parameterMin, ofParameter<glm::vec4>& parameterMax, float speed)
 {
 	auto result = false;
+	auto released = false;
 	auto tmpRefMin = parameterMin.get();
 	auto tmpRefMax = parameterMax.get();
-	if (ImGui::DragFloatRange2(GetUniqueName(name + " X"), &tmpRefMin.x, &tmpRefMax.x, speed, parameterMin.getMin().x, parameterMax.getMax().x))
-	{
-		result |= true;
-	}
-	if (ImGui::DragFloatRange2(GetUniqueName(name + " Y"), &tmpRefMin.y, &tmpRefMax.y, speed, parameterMin.getMin().y, parameterMax.getMax().y))
-	{
-		result |= true;
-	}
-	if (ImGui::DragFloatRange2(GetUniqueName(name + " Z"), &tmpRefMin.z, &tmpRefMax.z, speed, parameterMin.getMin().z, parameterMax.getMax().z))
-	{
-		result |= true;
-	}
-	if (ImGui::DragFloatRange2(GetUniqueName(name + " W"), &tmpRefMin.w, &tmpRefMax.w, speed, parameterMin.getMin().w, parameterMax.getMax().w))
-	{
-		result |= true;
-	}
-	if (result)
-	{
-		parameterMin.set(tmpRefMin);
-		parameterMax.set(tmpRefMax);
-		return true;
-	}
-	return false;
+	result |= ImGui::DragFloatRange2(GetUniqueName(name + " X"), &tmpRefMin.x, &tmpRefMax.x, speed, parameterMin.getMin().x, parameterMax.getMax().x);
+	released |= ImGui::IsItemDeactivatedAfterEdit();
+	result |= ImGui::DragFloatRange2(GetUniqueName(name + " Y"), &tmpRefMin.y, &tmpRefMax.y, speed, parameterMin.getMin().y, parameterMax.getMax().y);
+	released |= ImGui::IsItemDeactivatedAfterEdit();
+	result |= ImGui::DragFloatRange2(GetUniqueName(name + " Z"), &tmpRefMin.z, &tmpRefMax.z, speed, parameterMin.getMin().z, parameterMax.getMax().z);
+	released |= ImGui::IsItemDeactivatedAfterEdit();
+	result |= ImGui::DragFloatRange2(GetUniqueName(name + " W"), &tmpRefMin.w, &tmpRefMax.w, speed, parameterMin.getMin().w, parameterMax.getMax().w);
+	released |= ImGui::IsItemDeactivatedAfterEdit();
+	CommitParameter(parameterMin, tmpRefMin, result, released);
+	return CommitParameter(parameterMax, tmpRefMax, result, released);
 }
 
 #endif
@@ -776,9 +889,10 @@ bool ofxImGui::AddRange(const std::string& name, ofParameter<glm::vec4>& paramet
 bool ofxImGui::AddValues(const std::string& name, std::vector<glm::tvec2<int>>& values, int minValue, int maxValue)
 {
 	auto result = false;
+	std::string labelBuffer; // Only used without frame arena
 	for (size_t i = 0; i < values.size(); ++i)
 	{
-		const auto iname = name + " " + ofToString(i);
+		const char* iname = GetIndexedLabel(name, i, labelBuffer);
 		if (minValue == 0 && maxValue == 0)
 		{
 			result |= ImGui::DragInt2(GetUniqueName(iname), glm::value_ptr(values[i]));
@@ -795,9 +909,10 @@ bool ofxImGui::AddValues(const std::string& name, std::vector<glm::tvec2<int>>&
 bool ofxImGui::AddValues(const std::string& name, std::vector<glm::tvec3<int>>& values, int minValue, int maxValue)
 {
 	auto result = false;
+	std::string labelBuffer; // Only used without frame arena
 	for (size_t i = 0; i < values.size(); ++i)
 	{
-		const auto iname = name + " " + ofToString(i);
+		const char* iname = GetIndexedLabel(name, i, labelBuffer);
 		if (minValue == 0 && maxValue == 0)
 		{
 			result |= ImGui::DragInt3(GetUniqueName(iname), glm::value_ptr(values[i]));
@@ -814,9 +929,10 @@ bool ofxImGui::AddValues(const std::string& name, std::vector<glm::tvec3<int>>&
 bool ofxImGui::AddValues(const std::string& name, std::vector<glm::tvec4<int>>& values, int minValue, int maxValue)
 {
 	auto result = false;
+	std::string labelBuffer; // Only used without frame arena
 	for (size_t i = 0; i < values.size(); ++i)
 	{
-		const auto iname = name + " " + ofToString(i);
+		const char* iname = GetIndexedLabel(name, i, labelBuffer);
 		if (minValue == 0 && maxValue == 0)
 		{
 			result |= ImGui::DragInt4(GetUniqueName(iname), glm::value_ptr(values[i]));
@@ -833,9 +949,10 @@ bool ofxImGui::AddValues(const std::string& name, std::vector<glm::tvec4<int>>&
 bool ofxImGui::AddValues(const std::string& name, std::vector<glm::vec2>& values, float minValue, float maxValue)
 {
 	auto result = false;
+	std::string labelBuffer; // Only used without frame arena
 	for (size_t i = 0; i < values.size(); ++i)
 	{
-		const auto iname = name + " " + ofToString(i);
+		const char* iname = GetIndexedLabel(name, i, labelBuffer);
 		if (minValue == 0 && maxValue == 0)
 		{
 			result |= ImGui::DragFloat2(GetUniqueName(iname), glm::value_ptr(values[i]));
@@ -852,9 +969,10 @@ bool ofxImGui::AddValues(const std::string& name, std::vector<glm::vec2>& values
 bool ofxImGui::AddValues(const std::string& name, std::vector<glm::vec3>& values, float minValue, float maxValue)
 {
 	auto result = false;
+	std::string labelBuffer; // Only used without frame arena
 	for (size_t i = 0; i < values.size(); ++i)
 	{
-		const auto iname = name + " " + ofToString(i);
+		const char* iname = GetIndexedLabel(name, i, labelBuffer);
 		if (minValue == 0 && maxValue == 0)
 		{
 			result |= ImGui::DragFloat3(GetUniqueName(iname), glm::value_ptr(values[i]));
@@ -871,9 +989,10 @@ bool ofxImGui::AddValues(const std::string& name, std::vector<glm::vec3>& values
 bool ofxImGui::AddValues(const std::string& name, std::vector<glm::vec4>& values, float minValue, float maxValue)
 {
 	auto result = false;
+	std::string labelBuffer; // Only used without frame arena
 	for (size_t i = 0; i < values.size(); ++i)
 	{
-		const auto iname = name + " " + ofToString(i);
+		const char* iname = GetIndexedLabel(name, i, labelBuffer);
 		if (minValue == 0 && maxValue == 0)
 		{
 			result |= ImGui::DragFloat4(GetUniqueName(iname), glm::value_ptr(values[i]));
@@ -892,9 +1011,10 @@ bool ofxImGui::AddValues(const std::string& name, std::vector<glm::vec4>& values
 bool ofxImGui::AddValues(const std::string& name, std::vector<ofVec2f>& values, float minValue, float maxValue)
 {
 	auto result = false;
+	std::string labelBuffer; // Only used without frame arena
 	for (size_t i = 0; i < values.size(); ++i)
 	{
-		const auto iname = name + " " + ofToString(i);
+		const char* iname = GetIndexedLabel(name, i, labelBuffer);
 		if (minValue == 0 && maxValue == 0)
 		{
 			result |= ImGui::DragFloat2(GetUniqueName(iname), values[i].getPtr());
@@ -911,9 +1031,10 @@ bool ofxImGui::AddValues(const std::string& name, std::vector<ofVec2f>& values,
 bool ofxImGui::AddValues(const std::string& name, std::vector<ofVec3f>& values, float minValue, float maxValue)
 {
 	auto result = false;
+	std::string labelBuffer; // Only used without frame arena
 	for (size_t i = 0; i < values.size(); ++i)
 	{
-		const auto iname = name + " " + ofToString(i);
+		const char* iname = GetIndexedLabel(name, i, labelBuffer);
 		if (minValue == 0 && maxValue == 0)
 		{
 			result |= ImGui::DragFloat3(GetUniqueName(iname), values[i].getPtr());
@@ -930,9 +1051,10 @@ bool ofxImGui::AddValues(const std::string& name, std::vector<ofVec3f>& values,
 bool ofxImGui::AddValues(const std::string& name, std::vector<ofVec4f>& values, float minValue, float maxValue)
 {
 	auto result = false;
+	std::string labelBuffer; // Only used without frame arena
 	for (size_t i = 0; i < values.size(); ++i)
 	{
-		const auto iname = name + " " + ofToString(i);
+		const char* iname = GetIndexedLabel(name, i, labelBuffer);
 		if (minValue == 0 && maxValue == 0)
 		{
 			result |= ImGui::DragFloat4(GetUniqueName(iname), values[i].getPtr());
@@ -985,24 +1107,120 @@ void ofxImGui::AddImage(const ofTexture& texture, const glm::vec2& size)
 
 #endif
 
-static auto vector_getter = [](void* vec, int idx)
+//--------------------------------------------------------------
+ofxImGui::ListItems::ListItems(const char* (*_getter)(void* userData, int index), void* _userData, int _count, unsigned int _version)
+	: getter(_getter)
+	, userData(_userData)
+	, count(_count)
+	, version(_version)
+{}
+
+//--------------------------------------------------------------
+ofxImGui::ListItems::ListItems(const std::vector<std::string>& values, unsigned int _version)
+	: getter([](void* vec, int idx) { return static_cast<const std::vector<std::string>*>(vec)->at(idx).c_str(); })
+	, userData(const_cast<std::vector<std::string>*>(&values))
+	, count(static_cast<int>(values.size()))
+	, version(_version)
+{}
+
+//--------------------------------------------------------------
+namespace
+{
+	bool AddListItems(int* currIndex, const ofxImGui::ListItems& items)
+	{
+		auto result = false;
+		ImGuiListClipper clipper;
+		clipper.Begin(items.count);
+		// The current item gets the default focus, even when scrolled out
+		if (ImGui::IsWindowAppearing() && *currIndex >= 0 && *currIndex < items.count)
+		{
+			clipper.IncludeItemByIndex(*currIndex);
+		}
+		while (clipper.Step())
+		{
+			for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i)
+			{
+				const bool selected = (i == *currIndex);
+				ImGui::PushID(i);
+				if (ImGui::Selectable(items[i], selected))
+				{
+					*currIndex = i;
+					result = true;
+				}
+				if (selected)
+				{
+					ImGui::SetItemDefaultFocus();
+				}
+				ImGui::PopID();
+			}
+		}
+		return result;
+	}
+}
+
+//--------------------------------------------------------------
+bool ofxImGui::VectorCombo(const char* label, int* currIndex, const ListItems& items)
+{
+	if (items.count <= 0) { return false; }
+	const char* preview = (*currIndex >= 0 && *currIndex < items.count) ? items[*currIndex] : "";
+	if (!ImGui::BeginCombo(label, preview))
+	{
+		return false;
+	}
+	auto result = AddListItems(currIndex, items);
+	ImGui::EndCombo();
+	return result;
+}
+
+//--------------------------------------------------------------
+bool ofxImGui::VectorListBox(const char* label, int* currIndex, const ListItems& items, int heightInItems)
+{
+	if (items.count <= 0) { return false; }
+	ImVec2 size(0, 0);
+	if (heightInItems > 0)
+	{
+		size.y = ImGui::GetTextLineHeightWithSpacing() * heightInItems + ImGui::GetStyle().FramePadding.y * 2.0f;
+	}
+	if (!ImGui::BeginListBox(label, size))
+	{
+		return false;
+	}
+	auto result = AddListItems(currIndex, items);
+	ImGui::EndListBox();
+	return result;
+}
+
+//--------------------------------------------------------------
+bool ofxImGui::VectorCombo(const char* label, int* currIndex, const std::vector<std::string>& values)
 {
-	auto& vector = *static_cast<std::vector<std::string>*>(vec);
-	if (idx < 0 || idx >= static_cast<int>(vector.size())) { return ""; }
-	return (const char*) vector.at(idx).c_str();
-};
+	return VectorCombo(label, currIndex, ListItems(values));
+}
 
-bool ofxImGui::VectorCombo(const char* label, int* currIndex, std::vector<std::string>& values)
+//--------------------------------------------------------------
+bool ofxImGui::VectorListBox(const char* label, int* currIndex, const std::vector<std::string>& values)
 {
-	if (values.empty()) { return false; }
-	return ImGui::Combo(label, currIndex, vector_getter,
-						static_cast<void*>(&values), values.size());
+	return VectorListBox(label, currIndex, ListItems(values));
 }
 
-bool ofxImGui::VectorListBox(const char* label, int* currIndex, std::vector<std::string>& values)
+//--------------------------------------------------------------
+ImVec2 ofxImGui::CalcWidgetSize(ImVec2 size, float defaultHeight)
 {
-	if (values.empty()) { return false; }
-	return ImGui::ListBox(label, currIndex, vector_getter,
-				   static_cast<void*>(&values), values.size());
+	return ImGui::CalcItemSize(size, ImGui::CalcItemWidth(), defaultHeight);
 }
 
+//--------------------------------------------------------------
+ImVec2 ofxImGui::CalcWidgetSize(ImVec2 size, const ImVec2& defaultSize)
+{
+	return ImGui::CalcItemSize(size, defaultSize.x, defaultSize.y);
+}
+
+//--------------------------------------------------------------
+void ofxImGui::AddWidgetLabel(const char* label)
+{
+	const char* labelEnd = ImGui::FindRenderedTextEnd(label);
+	if (labelEnd != label)
+	{
+		ImGui::SameLine(0, ImGui::GetStyle().ItemInnerSpacing.x);
+		ImGui::TextUnformatted(label, labelEnd);
+	}
+}
@@ -7,7 +7,13 @@
 #include "ofTexture.h"
 #include "ofGLBaseTypes.h"
 #include "imgui.h"
+#include "FrameArena.h"
+#include "ParameterCommits.h"
 #include <stack> // Needed for Arch Linux
+#include <type_traits>
+#include <typeinfo>
+#include <limits>
+#include <functional>
 
 #include "gles1CompatibilityHacks.h" // needed on rpi3 for GL_TEXTURE_RECTANGLE
 
@@ -18,13 +24,30 @@ static const int kImGuiMargin = 10;
 namespace ofxImGui
 {
     
-    bool VectorCombo(const char* label, int* currIndex, std::vector<std::string>& values);
-    bool VectorListBox(const char* label, int* currIndex, std::vector<std::string>& values);
+	// Items of the list widgets, read on demand through the getter (no copies).
+	// Change version when the items change without changing count, to refresh the index of FilteredList.
+	struct ListItems
+	{
+		ListItems(const char* (*_getter)(void* userData, int index), void* _userData, int _count, unsigned int _version = 0);
+		ListItems(const std::vector<std::string>& values, unsigned int _version = 0);
+
+		const char* operator[](int index) const { return getter(userData, index); }
+
+		const char* (*getter)(void* userData, int index);
+		void* userData;
+		int count;
+		unsigned int version;
+	};
+
+	// Clipped : only the visible items are read. See FilteredList for a filter box.
+	bool VectorCombo(const char* label, int* currIndex, const ListItems& items);
+	bool VectorListBox(const char* label, int* currIndex, const ListItems& items, int heightInItems = -1);
+	bool VectorCombo(const char* label, int* currIndex, const std::vector<std::string>& values);
+	bool VectorListBox(const char* label, int* currIndex, const std::vector<std::string>& values);
 
     
 	struct WindowOpen
 	{
-		std::stack<std::vector<std::string>> usedNames;
 		std::shared_ptr<ofParameter<bool>> parameter;
 		bool value;
 	};
@@ -41,6 +64,10 @@ namespace ofxImGui
 		bool windowBlock;
 		int treeLevel;
 
+		// When parameter edits notify the listeners (see ParameterCommits.h), for the AddGroup() widgets
+		CommitPolicy commitPolicy;
+		float commitInterval; // Seconds, with CommitRateLimited
+
 		ofRectangle totalBounds;
 		ofRectangle screenBounds;
 	};
@@ -50,8 +77,24 @@ namespace ofxImGui
 	bool IsMouseOverGui();
 	bool IsAnyGuiActive();
 
+	// Unique widget labels within the current window or tree : the first occurrence of a name is returned as is,
+	// next ones get a hidden ID suffix ("name##2"). Occurrences are counted in a per-scope hash set, without heap allocations.
+	// Generated labels are valid until the next frame (frame arena), or for the next few calls outside of Gui::begin()/end().
 	const char * GetUniqueName(ofAbstractParameter& parameter);
 	const char * GetUniqueName(const std::string& candidate);
+	const char * GetUniqueName(const char* candidate);
+	// Same, as an ImGuiID for ImGui::PushID() : then use the plain name as label.
+	ImGuiID GetUniqueID(const char* name);
+	void PushUniqueID(const char* name); // Call ImGui::PopID() after
+	// Scopes of unique names, opened by BeginWindow() and BeginTree(). Push your own to reset the occurrences, e.g. per list row.
+	void PushUniqueNameScope();
+	void PopUniqueNameScope();
+
+	// Returns "name index", built in the frame arena when available (valid for this frame), otherwise in fallback.
+	const char * GetIndexedLabel(const std::string& name, std::size_t index, std::string& fallback);
+	// Returns the value as text, built in the frame arena for arithmetic types, otherwise in fallback (with ofToString()).
+	template<typename ValueType>
+	const char * GetValueLabel(const ValueType& value, std::string& fallback);
 
 	void SetNextWindow(Settings& settings);
 	bool BeginWindow(ofParameter<bool>& parameter, Settings& settings, bool collapse = true);
@@ -65,6 +108,17 @@ namespace ofxImGui
 
 	void AddGroup(ofParameterGroup& group, Settings& settings);
 
+	// AddGroup() resolves the widget of each parameter type once, then calls it directly.
+	// Register handlers for your own parameter types (or to replace a default one) :
+	//   ofxImGui::RegisterParameterHandler<ofParameter<MyType>>([](ofParameter<MyType>& parameter, ofxImGui::Settings& settings){ return changed; });
+	typedef std::function<bool(ofAbstractParameter& parameter, Settings& settings)> ParameterHandler;
+	template<typename ParameterType, typename Handler>
+	void RegisterParameterHandler(Handler handler);
+	// matches() tells if a parameter of another dynamic type can use the handler (derived types)
+	void RegisterParameterHandler(const std::type_info& type, ParameterHandler handler, std::function<bool(ofAbstractParameter&)> matches);
+	// Draws any parameter with its handler. Returns false if unchanged or unsupported.
+	bool AddParameter(ofAbstractParameter& parameter, Settings& settings);
+
 #if OF_VERSION_MINOR >= 10
 	bool AddParameter(ofParameter<glm::ivec2>& parameter);
 	bool AddParameter(ofParameter<glm::ivec3>& parameter);
@@ -94,6 +148,11 @@ namespace ofxImGui
 
 	bool AddParameter(ofParameter<void>& parameter, float width = 0);
 
+	// ImGuiDataType of the scalar types supported by the generic AddParameter() and AddValues() : all integer widths, float, double.
+	template<typename T, typename Enable = void>
+	struct ScalarDataType { static constexpr bool isSupported = false; };
+
+	// Generic version, for bool and scalar parameters (other types fail to compile). Unbounded ranges use a drag instead of a slider.
 	template<typename ParameterType>
 	bool AddParameter(ofParameter<ParameterType>& parameter);
 
@@ -114,6 +173,7 @@ namespace ofxImGui
 	bool AddRange(const std::string& name, ofParameter<glm::vec4>& parameterMin, ofParameter<glm::vec4>& parameterMax, float speed = 0.01f);
 #endif
 
+	// One widget per element : for large vectors, see ValuesEditor.
 #if OF_VERSION_MINOR >= 10
 	bool AddValues(const std::string& name, std::vector<glm::ivec2>& values, int minValue = 0, int maxValue = 0);
 	bool AddValues(const std::string& name, std::vector<glm::ivec3>& values, int minValue = 0, int maxValue = 0);
@@ -128,6 +188,7 @@ namespace ofxImGui
 	bool AddValues(const std::string& name, std::vector<ofVec3f>& values, float minValue = 0, float maxValue = 0);
 	bool AddValues(const std::string& name, std::vector<ofVec4f>& values, float minValue = 0, float maxValue = 0);
 
+	// Generic version, for bool and scalar values. minValue == maxValue uses a drag instead of a slider.
 	template<typename DataType>
 	bool AddValues(const std::string& name, std::vector<DataType>& values, DataType minValue, DataType maxValue);
 
@@ -137,6 +198,13 @@ namespace ofxImGui
     void AddImage(const ofBaseHasTexture& hasTexture, const glm::vec2& size);
     void AddImage(const ofTexture& texture, const glm::vec2& size);
 #endif
+
+	// For custom widgets drawn in a frame (plots, scopes, canvases...).
+	// Same as ImGui sizes : 0 for the default size (CalcItemWidth() wide), negative to align with the right / bottom edge.
+	ImVec2 CalcWidgetSize(ImVec2 size, float defaultHeight);
+	ImVec2 CalcWidgetSize(ImVec2 size, const ImVec2& defaultSize);
+	// Visible part of the label (until "##"), on the right of the last item
+	void AddWidgetLabel(const char* label);
 }
 
 inline ImTextureID GetImTextureID(const ofTexture& texture)
@@ -166,55 +234,116 @@ inline ImTextureID GetImTextureID(GLuint glID)
 }
 
 //--------------------------------------------------------------
-template<typename ParameterType>
-bool ofxImGui::AddParameter(ofParameter<ParameterType>& parameter)
+namespace ofxImGui
 {
-	auto tmpRef = parameter.get();
-	const auto& info = typeid(ParameterType);
-	if (info == typeid(float))
+	template<typename T>
+	struct ScalarDataType<T, typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value>::type>
 	{
-		if (ImGui::SliderFloat(GetUniqueName(parameter), (float *)&tmpRef, parameter.getMin(), parameter.getMax()))
-		{
-			parameter.set(tmpRef);
-			return true;
-		}
-		return false;
+		static constexpr bool isSupported = true;
+		static constexpr ImGuiDataType value = std::is_signed<T>::value ?
+			(sizeof(T) == 1 ? ImGuiDataType_S8 : sizeof(T) == 2 ? ImGuiDataType_S16 : sizeof(T) == 4 ? ImGuiDataType_S32 : ImGuiDataType_S64) :
+			(sizeof(T) == 1 ? ImGuiDataType_U8 : sizeof(T) == 2 ? ImGuiDataType_U16 : sizeof(T) == 4 ? ImGuiDataType_U32 : ImGuiDataType_U64);
+	};
+	template<>
+	struct ScalarDataType<float> { static constexpr bool isSupported = true; static constexpr ImGuiDataType value = ImGuiDataType_Float; };
+	template<>
+	struct ScalarDataType<double> { static constexpr bool isSupported = true; static constexpr ImGuiDataType value = ImGuiDataType_Double; };
+
+	// Sliders need a bounded range : ImGui asserts on ranges over half the type limits
+	template<typename T>
+	bool IsSliderRange(T minValue, T maxValue)
+	{
+		return minValue < maxValue && minValue >= std::numeric_limits<T>::lowest() / 2 && maxValue <= std::numeric_limits<T>::max() / 2;
 	}
-	if (info == typeid(int))
+
+	template<typename T>
+	bool AddScalar(const char* label, T& value, T minValue, T maxValue, std::false_type /*isBool*/)
 	{
-		if (ImGui::SliderInt(GetUniqueName(parameter), (int *)&tmpRef, parameter.getMin(), parameter.getMax()))
+		if (IsSliderRange(minValue, maxValue))
 		{
-			parameter.set(tmpRef);
-			return true;
+			return ImGui::SliderScalar(label, ScalarDataType<T>::value, &value, &minValue, &maxValue);
 		}
-		return false;
+		return ImGui::DragScalar(label, ScalarDataType<T>::value, &value);
 	}
-	if (info == typeid(bool))
+
+	template<typename T>
+	bool AddScalar(const char* label, T& value, T /*minValue*/, T /*maxValue*/, std::true_type /*isBool*/)
 	{
-		// fixme : this is so wrong ! See #139
-		if (ImGui::Checkbox(GetUniqueName(parameter), (bool *)&tmpRef))
-		{
-			parameter.set(tmpRef);
-			return true;
-		}
-		return false;
+		return ImGui::Checkbox(label, &value);
 	}
+}
 
-	ofLogWarning(__FUNCTION__) << "Could not create GUI element for type " << info.name();
-	return false;
+//--------------------------------------------------------------
+template<typename ParameterType>
+bool ofxImGui::AddParameter(ofParameter<ParameterType>& parameter)
+{
+	typedef std::is_same<ParameterType, bool> IsBool;
+	static_assert(IsBool::value || ScalarDataType<ParameterType>::isSupported, "ofxImGui::AddParameter() : unsupported parameter type, use another overload or write your own widget.");
+
+	ParameterType tmpRef = parameter.get();
+	const bool edited = AddScalar(GetUniqueName(parameter), tmpRef, parameter.getMin(), parameter.getMax(), IsBool());
+	return CommitParameter(parameter, tmpRef, edited, IsBool::value ? edited : ImGui::IsItemDeactivatedAfterEdit());
+}
+
+//--------------------------------------------------------------
+namespace ofxImGui
+{
+	template<typename ValueType>
+	const char * GetValueLabel(FrameArena& arena, const ValueType& value, std::string& fallback, std::true_type /*isArithmetic*/)
+	{
+		// Same output as the default ostream formatting
+		if (std::is_floating_point<ValueType>::value) return arena.format("%g", (double)value);
+		if (std::is_signed<ValueType>::value) return arena.format("%lld", (long long)value);
+		return arena.format("%llu", (unsigned long long)value);
+	}
+
+	template<typename ValueType>
+	const char * GetValueLabel(FrameArena& arena, const ValueType& value, std::string& fallback, std::false_type /*isArithmetic*/)
+	{
+		fallback = ofToString(value);
+		return fallback.c_str();
+	}
+}
+
+//--------------------------------------------------------------
+template<typename ValueType>
+const char * ofxImGui::GetValueLabel(const ValueType& value, std::string& fallback)
+{
+	FrameArena* arena = FrameArena::getCurrent();
+	if (arena == nullptr)
+	{
+		fallback = ofToString(value);
+		return fallback.c_str();
+	}
+	// Chars are printed as characters by ofToString()
+	typedef std::integral_constant<bool, std::is_arithmetic<ValueType>::value
+		&& !std::is_same<ValueType, char>::value && !std::is_same<ValueType, signed char>::value && !std::is_same<ValueType, unsigned char>::value> IsNumber;
+	return GetValueLabel(*arena, value, fallback, IsNumber());
+}
+
+//--------------------------------------------------------------
+template<typename ParameterType, typename Handler>
+void ofxImGui::RegisterParameterHandler(Handler handler)
+{
+	RegisterParameterHandler(typeid(ParameterType),
+		// Only called with matching parameters
+		[handler](ofAbstractParameter& parameter, Settings& settings){ return handler(static_cast<ParameterType&>(parameter), settings); },
+		[](ofAbstractParameter& parameter){ return dynamic_cast<ParameterType*>(&parameter) != nullptr; });
 }
 
 //--------------------------------------------------------------
 template<typename ParameterType>
 bool ofxImGui::AddText(ofParameter<ParameterType>& parameter, bool label)
 {
+	std::string labelBuffer; // Only used without frame arena
+	const char* text = GetValueLabel(parameter.get(), labelBuffer);
 	if (label)
 	{
-		ImGui::LabelText(parameter.getName().c_str(), ofToString(parameter.get()).c_str());
+		ImGui::LabelText(parameter.getName().c_str(), "%s", text);
 	}
 	else
 	{
-		ImGui::Text(ofToString(parameter.get()).c_str());
+		ImGui::TextUnformatted(text);
 	}
 	return true;
 }
@@ -223,27 +352,19 @@ bool ofxImGui::AddText(ofParameter<ParameterType>& parameter, bool label)
 template<typename DataType>
 bool ofxImGui::AddValues(const std::string& name, std::vector<DataType>& values, DataType minValue, DataType maxValue)
 {
+	typedef std::is_same<DataType, bool> IsBool;
+	static_assert(IsBool::value || ScalarDataType<DataType>::isSupported, "ofxImGui::AddValues() : unsupported value type, use another overload or write your own widget.");
+
 	auto result = false;
-	const auto& info = typeid(DataType);
-	for (int i = 0; i < values.size(); ++i)
+	std::string labelBuffer; // Only used without frame arena
+	for (size_t i = 0; i < values.size(); ++i)
 	{
-		const auto iname = name + " " + ofToString(i);
-		if (info == typeid(float))
-		{
-			result |= ImGui::SliderFloat(GetUniqueName(iname), *values[i], minValue, maxValue);
-		}
-		else if (info == typeid(int))
-		{
-			result |= ImGui::SliderInt(GetUniqueName(iname), *values[i], minValue, maxValue);
-		}
-		else if (info == typeid(bool))
-		{
-			result |= ImGui::Checkbox(GetUniqueName(iname), *values[i]);
-		}
-		else
+		// Copy : std::vector<bool> elements are proxies
+		DataType value = values[i];
+		if (AddScalar(GetUniqueName(GetIndexedLabel(name, i, labelBuffer)), value, minValue, maxValue, IsBool()))
 		{
-			ofLogWarning("Gui::AddValues") << "Could not create GUI element for type " << info.name();
-			return false;
+			values[i] = value;
+			result = true;
 		}
 	}
 	return result;
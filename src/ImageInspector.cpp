@@ -0,0 +1,424 @@
+#include "ImageInspector.h"
+
+#include "ImHelpers.h" // GetImTextureID(), CalcWidgetSize()
+#include "ofLog.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+
+#ifdef TARGET_WIN32
+	#include <windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+namespace ofxImGui
+{
+	namespace
+	{
+		std::atomic<unsigned int> nextVersion{ 1 };
+
+		// Skips whitespace and comments of PNM headers
+		void skipPnmSpaces(std::istream& stream){
+			while(stream.good()){
+				const int c = stream.peek();
+				if(c == '#'){
+					std::string comment;
+					std::getline(stream, comment);
+				}
+				else if(c == ' ' || c == '\t' || c == '\r' || c == '\n'){
+					stream.get();
+				}
+				else {
+					return;
+				}
+			}
+		}
+
+		ofPixelFormat getPixelFormat(int channels){
+			switch(channels){
+				case 1: return OF_PIXELS_GRAY;
+				case 2: return OF_PIXELS_GRAY_ALPHA;
+				case 3: return OF_PIXELS_RGB;
+				default: return OF_PIXELS_RGBA;
+			}
+		}
+
+		// Missing tiles of a frame, reused between frames
+		struct MissingTile
+		{
+			double distance; // To the view center, in tiles
+			int x;
+			int y;
+		};
+		thread_local std::vector<MissingTile> missingTiles;
+	}
+
+	//--------------------------------------------------------------
+	MappedImage::~MappedImage(){
+		close();
+	}
+
+	//--------------------------------------------------------------
+	bool MappedImage::mapRawFile(const std::string& path, int _width, int _height, int _channels, std::size_t headerSize){
+		close();
+		if(_width <= 0 || _height <= 0 || _channels < 1 || _channels > 4){
+			ofLogWarning("MappedImage::mapRawFile()") << "Invalid size or number of channels : " << _width << "x" << _height << "x" << _channels;
+			return false;
+		}
+		const std::size_t imageSize = (std::size_t)_width * _height * _channels;
+
+#ifdef TARGET_WIN32
+		HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		LARGE_INTEGER fileSize;
+		if(file == INVALID_HANDLE_VALUE || !GetFileSizeEx(file, &fileSize) || (std::size_t)fileSize.QuadPart < headerSize + imageSize){
+			ofLogWarning("MappedImage::mapRawFile()") << "Can't open " << path << " or it's too small for the image.";
+			if(file != INVALID_HANDLE_VALUE) CloseHandle(file);
+			return false;
+		}
+		HANDLE fileMapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		void* view = fileMapping ? MapViewOfFile(fileMapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+		if(!view){
+			ofLogWarning("MappedImage::mapRawFile()") << "Can't map " << path;
+			if(fileMapping) CloseHandle(fileMapping);
+			CloseHandle(file);
+			return false;
+		}
+		fileHandle = file;
+		mappingHandle = fileMapping;
+		mappingSize = (std::size_t)fileSize.QuadPart;
+#else
+		const int file = open(path.c_str(), O_RDONLY);
+		struct stat fileStat;
+		if(file < 0 || fstat(file, &fileStat) != 0 || (std::size_t)fileStat.st_size < headerSize + imageSize){
+			ofLogWarning("MappedImage::mapRawFile()") << "Can't open " << path << " or it's too small for the image.";
+			if(file >= 0) ::close(file);
+			return false;
+		}
+		void* view = mmap(nullptr, (std::size_t)fileStat.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+		::close(file); // The mapping keeps the file open
+		if(view == MAP_FAILED){
+			ofLogWarning("MappedImage::mapRawFile()") << "Can't map " << path;
+			return false;
+		}
+		mappingSize = (std::size_t)fileStat.st_size;
+#endif
+
+		mapping = view;
+		data = (const std::uint8_t*)view + headerSize;
+		width = _width;
+		height = _height;
+		channels = _channels;
+		rowStride = (std::size_t)_width * _channels;
+		version = nextVersion++;
+		return true;
+	}
+
+	//--------------------------------------------------------------
+	bool MappedImage::mapPnmFile(const std::string& path){
+		std::ifstream stream(path, std::ios::binary);
+		char magic[2] = { 0, 0 };
+		stream.read(magic, 2);
+		int _channels = magic[0] == 'P' && magic[1] == '5' ? 1 : magic[0] == 'P' && magic[1] == '6' ? 3 : 0;
+		int _width = 0, _height = 0, maxValue = 0;
+		skipPnmSpaces(stream);
+		stream >> _width;
+		skipPnmSpaces(stream);
+		stream >> _height;
+		skipPnmSpaces(stream);
+		stream >> maxValue;
+		stream.get(); // Single whitespace before the data
+		if(!stream.good() || _channels == 0 || maxValue != 255){
+			ofLogWarning("MappedImage::mapPnmFile()") << path << " isn't a binary 8 bits PGM (P5) or PPM (P6) file.";
+			return false;
+		}
+		const std::size_t headerSize = (std::size_t)stream.tellg();
+		stream.close();
+		return mapRawFile(path, _width, _height, _channels, headerSize);
+	}
+
+	//--------------------------------------------------------------
+	void MappedImage::setPixels(const ofPixels& pixels){
+		close();
+		if(!pixels.isAllocated() || pixels.getNumChannels() < 1 || pixels.getNumChannels() > 4) return;
+		data = pixels.getData();
+		width = (int)pixels.getWidth();
+		height = (int)pixels.getHeight();
+		channels = (int)pixels.getNumChannels();
+		rowStride = pixels.getBytesStride();
+		version = nextVersion++;
+	}
+
+	//--------------------------------------------------------------
+	void MappedImage::close(){
+		if(mapping){
+#ifdef TARGET_WIN32
+			UnmapViewOfFile(mapping);
+			CloseHandle((HANDLE)mappingHandle);
+			CloseHandle((HANDLE)fileHandle);
+			mappingHandle = fileHandle = nullptr;
+#else
+			munmap(mapping, mappingSize);
+#endif
+			mapping = nullptr;
+			mappingSize = 0;
+		}
+		data = nullptr;
+		width = height = channels = 0;
+		rowStride = 0;
+	}
+
+	//--------------------------------------------------------------
+	int MappedImage::getNumLevels(int tileSize) const{
+		int levels = 1;
+		while(((std::int64_t)tileSize << (levels - 1)) < std::max(width, height)) ++levels;
+		return levels;
+	}
+
+	//--------------------------------------------------------------
+	void MappedImage::readTile(int level, int tileX, int tileY, int tileSize, std::uint8_t* tile) const{
+		const std::int64_t step = (std::int64_t)1 << level;
+		const std::int64_t firstX = ((std::int64_t)tileX * tileSize) << level;
+		const int count = firstX < width ? (int)std::min<std::int64_t>(tileSize, (width - firstX + step - 1) / step) : 0; // Texels in the image
+		const std::size_t tileStride = (std::size_t)tileSize * channels;
+		std::vector<std::uint64_t> sums(level > 0 ? (std::size_t)count * channels : 0); // Of a row of footprints
+		for(int row = 0; row < tileSize; ++row, tile += tileStride){
+			const std::int64_t y = ((std::int64_t)tileY * tileSize + row) << level;
+			if(y >= height){
+				std::memset(tile, 0, tileStride * (tileSize - row));
+				return;
+			}
+			if(level == 0){
+				std::memcpy(tile, data + (std::size_t)y * rowStride + (std::size_t)firstX * channels, (std::size_t)count * channels);
+			}
+			else {
+				// Box filter : averages the texels of each footprint within the image, reading its rows in order
+				const std::int64_t rows = std::min<std::int64_t>(step, height - y);
+				const std::int64_t lastX = std::min<std::int64_t>(firstX + (std::int64_t)count * step, width);
+				std::fill(sums.begin(), sums.end(), 0);
+				for(std::int64_t footprintY = y; footprintY < y + rows; ++footprintY){
+					const std::uint8_t* texel = data + (std::size_t)footprintY * rowStride + (std::size_t)firstX * channels;
+					for(std::int64_t x = firstX; x < lastX; ++x, texel += channels){
+						std::uint64_t* sum = &sums[(std::size_t)((x - firstX) >> level) * channels];
+						for(int channel = 0; channel < channels; ++channel) sum[channel] += texel[channel];
+					}
+				}
+				std::uint8_t* out = tile;
+				for(int i = 0; i < count; ++i, out += channels){
+					const std::int64_t columns = std::min<std::int64_t>(step, width - (firstX + (std::int64_t)i * step));
+					const std::uint64_t area = (std::uint64_t)(rows * columns);
+					for(int channel = 0; channel < channels; ++channel){
+						out[channel] = (std::uint8_t)((sums[(std::size_t)i * channels + channel] + area / 2) / area);
+					}
+				}
+			}
+			std::memset(tile + (std::size_t)count * channels, 0, tileStride - (std::size_t)count * channels);
+		}
+	}
+
+	//--------------------------------------------------------------
+	ImageInspector::ImageInspector(int _tileSize, int _maxTiles){
+		tileSize = std::max(_tileSize, 16);
+		maxTiles = std::max(_maxTiles, 4);
+		tileSlots.reserve(maxTiles); // Slots don't move
+	}
+
+	//--------------------------------------------------------------
+	void ImageInspector::clearCache(){
+		tileSlots.clear();
+		tileIndexes.clear();
+	}
+
+	//--------------------------------------------------------------
+	ImageInspector::TileSlot* ImageInspector::findTile(std::uint64_t key){
+		auto found = tileIndexes.find(key);
+		if(found == tileIndexes.end()) return nullptr;
+		TileSlot& slot = tileSlots[found->second];
+		slot.lastUsed = frame;
+		return &slot;
+	}
+
+	//--------------------------------------------------------------
+	ImageInspector::TileSlot* ImageInspector::uploadTile(const MappedImage& image, int level, int tileX, int tileY){
+		// A new slot, or the least recently used one not drawn in this frame
+		int index = (int)tileSlots.size();
+		if(index < maxTiles){
+			tileSlots.emplace_back();
+		}
+		else {
+			index = -1;
+			for(int i = 0; i < (int)tileSlots.size(); ++i){
+				if(tileSlots[i].lastUsed != frame && (index < 0 || tileSlots[i].lastUsed < tileSlots[index].lastUsed)) index = i;
+			}
+			if(index < 0) return nullptr; // All cached tiles are visible
+			tileIndexes.erase(tileSlots[index].key);
+		}
+
+		const ofPixelFormat format = getPixelFormat(image.getNumChannels());
+		if(!tilePixels.isAllocated() || (int)tilePixels.getWidth() != tileSize || tilePixels.getPixelFormat() != format){
+			tilePixels.allocate(tileSize, tileSize, format);
+		}
+		image.readTile(level, tileX, tileY, tileSize, tilePixels.getData());
+
+		TileSlot& slot = tileSlots[index];
+		if(!slot.texture.isAllocated()){
+			slot.texture.allocate(tilePixels, false); // GL_TEXTURE_2D, for ImGui
+			slot.texture.setTextureMinMagFilter(GL_LINEAR, GL_NEAREST); // Sharp texels when zoomed in
+		}
+		slot.texture.loadData(tilePixels);
+		slot.key = getKey(level, tileX, tileY);
+		slot.lastUsed = frame;
+		tileIndexes[slot.key] = index;
+		++numUploads;
+		return &slot;
+	}
+
+	//--------------------------------------------------------------
+	bool ImageInspector::draw(const char* label, const MappedImage& image, ImVec2 size){
+		const ImGuiStyle& style = ImGui::GetStyle();
+		size = CalcWidgetSize(size, ImGui::GetFrameHeight() * 12);
+
+		ImGui::InvisibleButton(label, size);
+		ImGui::SetItemKeyOwner(ImGuiKey_MouseWheelY); // Zooms instead of scrolling the window
+		const bool hovered = ImGui::IsItemHovered();
+		const bool active = ImGui::IsItemActive();
+		const ImVec2 frameMin = ImGui::GetItemRectMin();
+		const ImVec2 frameMax = ImGui::GetItemRectMax();
+		const ImVec2 innerMin(frameMin.x + style.FramePadding.x, frameMin.y + style.FramePadding.y);
+		const ImVec2 innerMax(frameMax.x - style.FramePadding.x, frameMax.y - style.FramePadding.y);
+		AddWidgetLabel(label);
+
+		ImDrawList* drawList = ImGui::GetWindowDrawList();
+		drawList->AddRectFilled(frameMin, frameMax, ImGui::GetColorU32(ImGuiCol_FrameBg), style.FrameRounding);
+
+		++frame;
+		numUploads = 0;
+		hoveredX = hoveredY = -1;
+		const float innerWidth = innerMax.x - innerMin.x;
+		const float innerHeight = innerMax.y - innerMin.y;
+		if(!image.isLoaded() || innerWidth < 1 || innerHeight < 1){
+			return hovered;
+		}
+		if(&image != cachedImage || image.getVersion() != cachedVersion){
+			clearCache();
+			cachedImage = &image;
+			cachedVersion = image.getVersion();
+			fitRequested = true;
+		}
+
+		// View
+		const int width = image.getWidth();
+		const int height = image.getHeight();
+		const ImGuiIO& io = ImGui::GetIO();
+		const float fitZoom = std::min(innerWidth / width, innerHeight / height);
+		if(fitRequested || (hovered && ImGui::IsMouseDoubleClicked(ImGuiMouseButton_Left))){
+			zoom = fitZoom;
+			centerX = width * 0.5;
+			centerY = height * 0.5;
+			fitRequested = false;
+		}
+		const ImVec2 innerCenter((innerMin.x + innerMax.x) * 0.5f, (innerMin.y + innerMax.y) * 0.5f);
+		if(hovered && io.MouseWheel != 0){
+			// Keeps the texel under the cursor
+			const double mouseX = centerX + (io.MousePos.x - innerCenter.x) / zoom;
+			const double mouseY = centerY + (io.MousePos.y - innerCenter.y) / zoom;
+			zoom = std::max(fitZoom * 0.25f, std::min(64.0f, zoom * std::pow(1.25f, io.MouseWheel)));
+			centerX = mouseX - (io.MousePos.x - innerCenter.x) / zoom;
+			centerY = mouseY - (io.MousePos.y - innerCenter.y) / zoom;
+		}
+		if(active && ImGui::IsMouseDragging(ImGuiMouseButton_Left, 0.0f)){
+			centerX -= io.MouseDelta.x / zoom;
+			centerY -= io.MouseDelta.y / zoom;
+		}
+		centerX = std::max(0.0, std::min((double)width, centerX));
+		centerY = std::max(0.0, std::min((double)height, centerY));
+		const double viewX = centerX - innerWidth * 0.5 / zoom; // Texel at innerMin
+		const double viewY = centerY - innerHeight * 0.5 / zoom;
+
+		// Level with texels at least as large as pixels, and its visible tiles
+		const int numLevels = image.getNumLevels(tileSize);
+		const int level = zoom < 1.0f ? std::min(numLevels - 1, (int)std::floor(std::log2(1.0 / zoom))) : 0;
+		const double tileTexels = (double)((std::int64_t)tileSize << level);
+		const int numTilesX = (int)std::ceil(width / tileTexels);
+		const int numTilesY = (int)std::ceil(height / tileTexels);
+		const int firstTileX = std::max(0, (int)std::floor(viewX / tileTexels));
+		const int firstTileY = std::max(0, (int)std::floor(viewY / tileTexels));
+		const int lastTileX = std::min(numTilesX - 1, (int)std::floor((viewX + innerWidth / zoom) / tileTexels));
+		const int lastTileY = std::min(numTilesY - 1, (int)std::floor((viewY + innerHeight / zoom) / tileTexels));
+
+		// Draws the texels of a tile of the level, from a cached tile of this level or a coarser one
+		auto drawTile = [&](const TileSlot& slot, int slotLevel, int tileX, int tileY){
+			const double x0 = tileX * tileTexels;
+			const double y0 = tileY * tileTexels;
+			const double x1 = std::min((double)width, x0 + tileTexels);
+			const double y1 = std::min((double)height, y0 + tileTexels);
+			const double slotTexels = (double)((std::int64_t)tileSize << slotLevel);
+			const double slotX = (tileX >> (slotLevel - level)) * slotTexels;
+			const double slotY = (tileY >> (slotLevel - level)) * slotTexels;
+			drawList->AddImage(GetImTextureID(slot.texture),
+				ImVec2(innerMin.x + (float)((x0 - viewX) * zoom), innerMin.y + (float)((y0 - viewY) * zoom)),
+				ImVec2(innerMin.x + (float)((x1 - viewX) * zoom), innerMin.y + (float)((y1 - viewY) * zoom)),
+				ImVec2((float)((x0 - slotX) / slotTexels), (float)((y0 - slotY) / slotTexels)),
+				ImVec2((float)((x1 - slotX) / slotTexels), (float)((y1 - slotY) / slotTexels)));
+		};
+
+		drawList->PushClipRect(innerMin, innerMax, true);
+		missingTiles.resize(0);
+		for(int tileY = firstTileY; tileY <= lastTileY; ++tileY){
+			for(int tileX = firstTileX; tileX <= lastTileX; ++tileX){
+				if(const TileSlot* slot = findTile(getKey(level, tileX, tileY))){
+					drawTile(*slot, level, tileX, tileY);
+				}
+				else {
+					const double dx = (tileX + 0.5) - centerX / tileTexels;
+					const double dy = (tileY + 0.5) - centerY / tileTexels;
+					missingTiles.push_back({ dx * dx + dy * dy, tileX, tileY });
+				}
+			}
+		}
+		std::sort(missingTiles.begin(), missingTiles.end(), [](const MissingTile& a, const MissingTile& b){ return a.distance < b.distance; });
+		for(const MissingTile& missing : missingTiles){
+			const TileSlot* slot = numUploads < maxUploadsPerFrame ? uploadTile(image, level, missing.x, missing.y) : nullptr;
+			if(slot){
+				drawTile(*slot, level, missing.x, missing.y);
+				continue;
+			}
+			for(int parentLevel = level + 1; parentLevel < numLevels; ++parentLevel){
+				const int shift = parentLevel - level;
+				if(const TileSlot* parent = findTile(getKey(parentLevel, missing.x >> shift, missing.y >> shift))){
+					drawTile(*parent, parentLevel, missing.x, missing.y);
+					break;
+				}
+			}
+		}
+		drawList->PopClipRect();
+
+		// Texel under the cursor
+		if(hovered){
+			const int x = (int)std::floor(viewX + (io.MousePos.x - innerMin.x) / zoom);
+			const int y = (int)std::floor(viewY + (io.MousePos.y - innerMin.y) / zoom);
+			if(x >= 0 && y >= 0 && x < width && y < height){
+				hoveredX = x;
+				hoveredY = y;
+				if(!active && ImGui::BeginTooltip()){
+					const std::uint8_t* texel = image.getTexel(x, y);
+					ImGui::Text("%d, %d (zoom %.3g, level %d)", x, y, zoom, level);
+					switch(image.getNumChannels()){
+						case 1: ImGui::Text("Gray %u", texel[0]); break;
+						case 2: ImGui::Text("Gray %u  Alpha %u", texel[0], texel[1]); break;
+						case 3: ImGui::Text("R %u  G %u  B %u", texel[0], texel[1], texel[2]); break;
+						default: ImGui::Text("R %u  G %u  B %u  A %u", texel[0], texel[1], texel[2], texel[3]); break;
+					}
+					ImGui::EndTooltip();
+				}
+			}
+		}
+		return hovered;
+	}
+}
@@ -0,0 +1,128 @@
+#pragma once
+
+#include "ofPixels.h"
+#include "ofTexture.h"
+#include "imgui.h"
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Zoomable inspector of images larger than GL_MAX_TEXTURE_SIZE or the VRAM (gigapixel scans, render outputs...).
+// - MappedImage maps raw or binary PNM (.pgm, .ppm) 8 bits images into memory : the OS only loads the pages that are read.
+//   It can also wrap ofPixels.
+// - ImageInspector draws the visible tiles of the level matching the zoom. A level n texel is the average of a 2^n x 2^n
+//   footprint (box filter, no moire) : making a tile reads up to 4^n tileSize^2 texels, once, then it's cached.
+// - Tiles are uploaded to a fixed pool of textures (LRU cache), a few per frame, nearest to the center first.
+//   Missing tiles are drawn from a cached coarser level meanwhile.
+// - Mouse wheel zooms around the cursor, dragging pans, double-click fits the image. The tooltip shows the texel values under the cursor.
+// Usage :
+//   ofxImGui::MappedImage image; ofxImGui::ImageInspector inspector; // Members of your ofApp
+//   In setup() : image.mapPnmFile(ofToDataPath("scan.ppm"));
+//   In draw() : inspector.draw("Scan", image, ImVec2(-1, -1));
+
+namespace ofxImGui
+{
+	class MappedImage
+	{
+	public:
+		MappedImage(){}
+		~MappedImage();
+
+		// Prevent making copies
+		MappedImage(const MappedImage&) = delete;
+		MappedImage& operator=(const MappedImage&) = delete;
+
+		// Interleaved 8 bits rows (1 to 4 channels), after headerSize bytes
+		bool mapRawFile(const std::string& path, int width, int height, int channels, std::size_t headerSize = 0);
+		// Binary PGM (P5) or PPM (P6), maxval 255
+		bool mapPnmFile(const std::string& path);
+		// Not copied : the pixels have to outlive their use
+		void setPixels(const ofPixels& pixels);
+		void close();
+
+		bool isLoaded() const { return data != nullptr; }
+		int getWidth() const { return width; }
+		int getHeight() const { return height; }
+		int getNumChannels() const { return channels; }
+		unsigned int getVersion() const { return version; } // Changes when the image is (re)loaded
+		const std::uint8_t* getTexel(int x, int y) const { return data + (std::size_t)y * rowStride + (std::size_t)x * channels; }
+
+		// Levels until the image fits in a tile
+		int getNumLevels(int tileSize) const;
+		// Texels of a tile, each the average of the (x << level, y << level) 2^level footprint, black outside of the image
+		void readTile(int level, int tileX, int tileY, int tileSize, std::uint8_t* tile) const;
+
+	private:
+		const std::uint8_t* data = nullptr;
+		std::size_t rowStride = 0;
+		int width = 0;
+		int height = 0;
+		int channels = 0;
+		unsigned int version = 0;
+
+		void* mapping = nullptr;
+		std::size_t mappingSize = 0;
+#ifdef TARGET_WIN32
+		void* fileHandle = nullptr;
+		void* mappingHandle = nullptr;
+#endif
+	};
+
+	class ImageInspector
+	{
+	public:
+		explicit ImageInspector(int tileSize = 256, int maxTiles = 192);
+
+		// Returns true when hovered
+		bool draw(const char* label, const MappedImage& image, ImVec2 size = ImVec2(0, 0));
+
+		void fit() { fitRequested = true; }
+		float getZoom() const { return zoom; } // Pixels per texel
+		void setZoom(float _zoom) { zoom = _zoom; }
+		void setMaxUploadsPerFrame(int uploads) { maxUploadsPerFrame = uploads; }
+		// Texel under the cursor, -1 when not hovered
+		int getHoveredX() const { return hoveredX; }
+		int getHoveredY() const { return hoveredY; }
+		// Drops the cached tiles (after modifying the pixels of the image)
+		void clearCache();
+
+		int getNumCachedTiles() const { return (int)tileSlots.size(); }
+		int getNumUploads() const { return numUploads; } // Last draw
+
+	private:
+		struct TileSlot
+		{
+			ofTexture texture;
+			std::uint64_t key = 0;
+			std::uint64_t lastUsed = 0;
+		};
+
+		static std::uint64_t getKey(int level, int tileX, int tileY) { return ((std::uint64_t)level << 56) | ((std::uint64_t)tileY << 28) | (std::uint64_t)tileX; }
+		TileSlot* findTile(std::uint64_t key);
+		TileSlot* uploadTile(const MappedImage& image, int level, int tileX, int tileY);
+
+		int tileSize;
+		int maxTiles;
+		int maxUploadsPerFrame = 4;
+		int numUploads = 0;
+		std::uint64_t frame = 0;
+
+		std::vector<TileSlot> tileSlots;
+		std::unordered_map<std::uint64_t, int> tileIndexes; // Per key, in tileSlots
+		ofPixels tilePixels; // Upload buffer
+
+		// Image of the cached tiles
+		const MappedImage* cachedImage = nullptr;
+		unsigned int cachedVersion = 0;
+
+		// View : texel at the center and pixels per texel
+		double centerX = 0;
+		double centerY = 0;
+		float zoom = 1.0f;
+		bool fitRequested = true;
+		int hoveredX = -1;
+		int hoveredY = -1;
+	};
+}
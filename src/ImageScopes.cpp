@@ -0,0 +1,417 @@
+#include "ImageScopes.h"
+
+#include "ImHelpers.h" // GetImTextureID(), CalcWidgetSize()
+#include "ofLog.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace ofxImGui
+{
+	namespace
+	{
+		// Per analysed pixel of a row, reused between rows and frames
+		struct RowBuffers
+		{
+			std::vector<std::uint8_t> red, green, blue, luma, cb, cr;
+			std::vector<int> columns; // Waveform column of each analysed pixel
+		};
+		thread_local RowBuffers rowBuffers;
+
+		// Counts values in 4 interleaved sub-histograms : repeated values (flat areas) don't wait for the previous increment of the same bin
+		void countValues(const std::uint8_t* values, std::size_t count, std::uint32_t (*subHistograms)[256]){
+			std::size_t i = 0;
+			for(; i + 4 <= count; i += 4){
+				++subHistograms[0][values[i]];
+				++subHistograms[1][values[i + 1]];
+				++subHistograms[2][values[i + 2]];
+				++subHistograms[3][values[i + 3]];
+			}
+			for(; i < count; ++i){
+				++subHistograms[0][values[i]];
+			}
+		}
+
+		std::uint32_t getMax(const std::uint32_t* values, std::size_t count){
+			std::uint32_t max = 0;
+			for(std::size_t i = 0; i < count; ++i){
+				max = std::max(max, values[i]);
+			}
+			return max;
+		}
+
+		const ImU32 channelColors[ScopeData::NumChannels] = { IM_COL32(255, 64, 64, 255), IM_COL32(64, 255, 64, 255), IM_COL32(80, 120, 255, 255), IM_COL32(230, 230, 230, 255) };
+		const char* channelNames[ScopeData::NumChannels] = { "Red", "Green", "Blue", "Luma" };
+	}
+
+	//--------------------------------------------------------------
+	void ComputeScopes(const ofPixels& pixels, ScopeData& data, ScopeFlags flags, int step, int waveformColumns){
+		std::memset(data.histogram, 0, sizeof(data.histogram));
+		data.histogramMax = data.waveformMax = data.vectorscopeMax = 0;
+		data.numPixels = 0;
+		if(!pixels.isAllocated()) return;
+
+		// Channel offsets
+		int red = 0, green = 1, blue = 2;
+		switch(pixels.getPixelFormat()){
+			case OF_PIXELS_GRAY: case OF_PIXELS_GRAY_ALPHA: red = green = blue = 0; break;
+			case OF_PIXELS_RGB: case OF_PIXELS_RGBA: break;
+			case OF_PIXELS_BGR: case OF_PIXELS_BGRA: red = 2; blue = 0; break;
+			default:
+				ofLogWarning("ofxImGui::ComputeScopes()") << "Only gray, RGB and BGR pixels (with alpha) are supported.";
+				return;
+		}
+		data.hasColor = red != blue;
+
+		step = std::max(step, 1);
+		const std::size_t width = pixels.getWidth();
+		const std::size_t height = pixels.getHeight();
+		const std::size_t channels = pixels.getNumChannels();
+		const std::size_t rowStride = pixels.getBytesStride();
+		const std::size_t count = (width + step - 1) / step; // Analysed pixels per row
+
+		const bool doWaveform = (flags & ScopeFlags_Waveform) != 0;
+		const bool doVectorscope = (flags & ScopeFlags_Vectorscope) != 0 && data.hasColor;
+		const int columns = (int)std::min<std::size_t>(std::max(waveformColumns, 1), std::max<std::size_t>(width, 1));
+		data.waveformColumns = doWaveform ? columns : 0;
+		data.waveform.assign(doWaveform ? (std::size_t)columns * 256 : 0, 0);
+		data.vectorscope.assign(doVectorscope ? ScopeData::vectorscopeSize * ScopeData::vectorscopeSize : 0, 0);
+
+		RowBuffers& row = rowBuffers;
+		row.red.resize(count);
+		row.green.resize(count);
+		row.blue.resize(count);
+		row.luma.resize(count);
+		row.cb.resize(count);
+		row.cr.resize(count);
+		row.columns.resize(count);
+		for(std::size_t i = 0; i < count; ++i){
+			row.columns[i] = (int)(i * step * columns / width);
+		}
+
+		std::uint32_t subHistograms[ScopeData::NumChannels][4][256];
+		std::memset(subHistograms, 0, sizeof(subHistograms));
+
+		const std::uint8_t* rowData = pixels.getData();
+		const std::size_t pixelStride = channels * step;
+		for(std::size_t y = 0; y < height; y += step, rowData += rowStride * step){
+			// Deinterleave, then per channel loops without branches (vectorized)
+			std::uint8_t* r = row.red.data();
+			std::uint8_t* g = row.green.data();
+			std::uint8_t* b = row.blue.data();
+			std::uint8_t* luma = row.luma.data();
+			const std::uint8_t* pixel = rowData;
+			for(std::size_t i = 0; i < count; ++i, pixel += pixelStride){
+				r[i] = pixel[red];
+				g[i] = pixel[green];
+				b[i] = pixel[blue];
+			}
+			if(data.hasColor){
+				// BT.601 in 8 bits fixed point : 77 + 150 + 29 = 256, same model as the chroma
+				for(std::size_t i = 0; i < count; ++i){
+					luma[i] = (std::uint8_t)((77 * r[i] + 150 * g[i] + 29 * b[i] + 128) >> 8);
+				}
+			}
+			else {
+				std::memcpy(luma, r, count);
+			}
+
+			if(flags & ScopeFlags_Histogram){
+				if(data.hasColor){
+					countValues(r, count, subHistograms[ScopeData::Red]);
+					countValues(g, count, subHistograms[ScopeData::Green]);
+					countValues(b, count, subHistograms[ScopeData::Blue]);
+				}
+				countValues(luma, count, subHistograms[ScopeData::Luma]);
+			}
+			if(doWaveform){
+				// Bright at the top
+				std::uint32_t* waveform = data.waveform.data();
+				const int* column = row.columns.data();
+				for(std::size_t i = 0; i < count; ++i){
+					++waveform[(255 - luma[i]) * columns + column[i]];
+				}
+			}
+			if(doVectorscope){
+				// BT.601 chroma, offset to stay positive before the shift, halved to the vectorscope size
+				std::uint8_t* cb = row.cb.data();
+				std::uint8_t* cr = row.cr.data();
+				for(std::size_t i = 0; i < count; ++i){
+					cb[i] = (std::uint8_t)((-38 * r[i] - 74 * g[i] + 112 * b[i] + 32768) >> 9);
+					cr[i] = (std::uint8_t)((112 * r[i] - 94 * g[i] - 18 * b[i] + 32768) >> 9);
+				}
+				// Red at the top, blue at the right
+				std::uint32_t* vectorscope = data.vectorscope.data();
+				for(std::size_t i = 0; i < count; ++i){
+					++vectorscope[(ScopeData::vectorscopeSize - 1 - cr[i]) * ScopeData::vectorscopeSize + cb[i]];
+				}
+			}
+			data.numPixels += count;
+		}
+
+		for(int channel = 0; channel < ScopeData::NumChannels; ++channel){
+			for(int value = 0; value < 256; ++value){
+				const std::uint32_t* sub = &subHistograms[channel][0][value];
+				data.histogram[channel][value] = sub[0] + sub[256] + sub[512] + sub[768];
+			}
+		}
+		data.histogramMax = getMax(&data.histogram[0][0], ScopeData::NumChannels * 256);
+		data.waveformMax = getMax(data.waveform.data(), data.waveform.size());
+		data.vectorscopeMax = getMax(data.vectorscope.data(), data.vectorscope.size());
+	}
+
+	//--------------------------------------------------------------
+	bool AddHistogram(const ofPixels& pixels, ImVec2 size){
+		// Large images are subsampled to about a million pixels, enough for the shape of the histogram
+		int step = 1;
+		while((pixels.getWidth() / step) * (pixels.getHeight() / step) > (1 << 20)) ++step;
+
+		static thread_local ScopeData data; // Reused between calls
+		ComputeScopes(pixels, data, ScopeFlags_Histogram, step);
+		ImGui::PushID(&pixels);
+		const bool hovered = AddHistogram("##Histogram", data, size);
+		ImGui::PopID();
+		return hovered;
+	}
+
+	//--------------------------------------------------------------
+	bool AddHistogram(const char* label, const ScopeData& data, ImVec2 size){
+		const ImGuiStyle& style = ImGui::GetStyle();
+		size = CalcWidgetSize(size, ImGui::GetFrameHeight() * 4);
+		ImGui::InvisibleButton(label, size);
+		const bool hovered = ImGui::IsItemHovered();
+		const ImVec2 frameMin = ImGui::GetItemRectMin();
+		const ImVec2 frameMax = ImGui::GetItemRectMax();
+		const ImVec2 innerMin(frameMin.x + style.FramePadding.x, frameMin.y + style.FramePadding.y);
+		const ImVec2 innerMax(frameMax.x - style.FramePadding.x, frameMax.y - style.FramePadding.y);
+		AddWidgetLabel(label);
+
+		ImDrawList* drawList = ImGui::GetWindowDrawList();
+		drawList->AddRectFilled(frameMin, frameMax, ImGui::GetColorU32(ImGuiCol_FrameBg), style.FrameRounding);
+		if(data.histogramMax == 0 || innerMax.x <= innerMin.x || innerMax.y <= innerMin.y){
+			return hovered;
+		}
+
+		// Per channel : a translucent fill and an outline of 256 points
+		const float binWidth = (innerMax.x - innerMin.x) / 255.0f;
+		const float scale = (innerMax.y - innerMin.y) / data.histogramMax;
+		ImVec2 points[256];
+		drawList->PushClipRect(innerMin, innerMax, true);
+		for(int channel = data.hasColor ? 0 : ScopeData::Luma; channel < ScopeData::NumChannels; ++channel){
+			const std::uint32_t* histogram = data.histogram[channel];
+			for(int value = 0; value < 256; ++value){
+				points[value] = ImVec2(innerMin.x + value * binWidth, innerMax.y - histogram[value] * scale);
+			}
+			const ImU32 color = channelColors[channel];
+			drawList->PathLineTo(ImVec2(innerMin.x, innerMax.y));
+			for(const ImVec2& point : points){
+				drawList->PathLineTo(point);
+			}
+			drawList->PathLineTo(innerMax);
+			drawList->PathFillConcave((color & ~IM_COL32_A_MASK) | IM_COL32(0, 0, 0, 40));
+			drawList->AddPolyline(points, 256, color, ImDrawFlags_None, 1.0f);
+		}
+		drawList->PopClipRect();
+
+		if(hovered && ImGui::BeginTooltip()){
+			const int value = std::max(0, std::min(255, (int)std::round((ImGui::GetIO().MousePos.x - innerMin.x) / binWidth)));
+			ImGui::Text("Value %d", value);
+			for(int channel = data.hasColor ? 0 : ScopeData::Luma; channel < ScopeData::NumChannels; ++channel){
+				ImGui::Text("%s : %u (%.2f%%)", channelNames[channel], data.histogram[channel][value], data.numPixels > 0 ? 100.0 * data.histogram[channel][value] / data.numPixels : 0.0);
+			}
+			ImGui::EndTooltip();
+		}
+		return hovered;
+	}
+
+	//--------------------------------------------------------------
+	ImageScopes::ImageScopes(){
+	}
+
+	//--------------------------------------------------------------
+	ImageScopes::~ImageScopes(){
+		stopWorker();
+	}
+
+	//--------------------------------------------------------------
+	void ImageScopes::setThreaded(bool threaded){
+		if(threaded == isThreaded()) return;
+		if(threaded){
+			worker = std::thread(&ImageScopes::workerLoop, this);
+		}
+		else {
+			stopWorker();
+		}
+	}
+
+	//--------------------------------------------------------------
+	void ImageScopes::stopWorker(){
+		if(!worker.joinable()) return;
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			quit = true;
+		}
+		condition.notify_one();
+		worker.join();
+		quit = false;
+		hasPendingPixels = false;
+	}
+
+	//--------------------------------------------------------------
+	void ImageScopes::update(const ofPixels& pixels){
+		if(!isThreaded()){
+			ComputeScopes(pixels, displayData, flags, step, waveformColumns);
+			waveformDirty = vectorscopeDirty = true;
+			return;
+		}
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			pendingPixels = pixels;
+			pendingFlags = flags;
+			pendingStep = step;
+			pendingColumns = waveformColumns;
+			hasPendingPixels = true;
+		}
+		condition.notify_one();
+	}
+
+	//--------------------------------------------------------------
+	void ImageScopes::workerLoop(){
+		ofPixels pixels;
+		ScopeData data; // Swapped with readyData : buffers are reused
+		std::unique_lock<std::mutex> lock(mutex);
+		while(true){
+			condition.wait(lock, [this]{ return quit || hasPendingPixels; });
+			if(quit) return;
+			pixels.swap(pendingPixels);
+			hasPendingPixels = false;
+			const ScopeFlags jobFlags = pendingFlags;
+			const int jobStep = pendingStep;
+			const int jobColumns = pendingColumns;
+			lock.unlock();
+
+			ComputeScopes(pixels, data, jobFlags, jobStep, jobColumns);
+
+			lock.lock();
+			std::swap(readyData, data);
+			hasReadyData = true;
+		}
+	}
+
+	//--------------------------------------------------------------
+	void ImageScopes::swapResults(){
+		if(!isThreaded()) return;
+		std::lock_guard<std::mutex> lock(mutex);
+		if(hasReadyData){
+			std::swap(displayData, readyData);
+			hasReadyData = false;
+			waveformDirty = vectorscopeDirty = true;
+		}
+	}
+
+	//--------------------------------------------------------------
+	const ScopeData& ImageScopes::getData(){
+		swapResults();
+		return displayData;
+	}
+
+	//--------------------------------------------------------------
+	void ImageScopes::updateTexture(ofTexture& texture, ofPixels& pixels, const std::vector<std::uint32_t>& density, int width, int height, std::uint32_t max){
+		// Log scale : a few pixels stay visible next to large flat areas
+		const bool resized = !pixels.isAllocated() || (int)pixels.getWidth() != width || (int)pixels.getHeight() != height;
+		if(resized){
+			pixels.allocate(width, height, OF_PIXELS_GRAY);
+		}
+		std::uint8_t* values = pixels.getData();
+		const float scale = max > 0 ? 255.0f / std::log(1.0f + max) : 0.0f;
+		float logs[256]; // Small counts are the most frequent
+		for(int count = 0; count < 256; ++count){
+			logs[count] = std::log(1.0f + count) * scale;
+		}
+		for(std::size_t i = 0, size = density.size(); i < size; ++i){
+			const std::uint32_t count = density[i];
+			values[i] = (std::uint8_t)(count < 256 ? logs[count] : std::log(1.0f + count) * scale);
+		}
+		if(resized){
+			texture.allocate(pixels, false); // GL_TEXTURE_2D, for ImGui
+		}
+		texture.loadData(pixels);
+	}
+
+	//--------------------------------------------------------------
+	bool ImageScopes::drawHistogram(const char* label, ImVec2 size){
+		swapResults();
+		return AddHistogram(label, displayData, size);
+	}
+
+	//--------------------------------------------------------------
+	bool ImageScopes::drawWaveform(const char* label, ImVec2 size){
+		swapResults();
+		const ImGuiStyle& style = ImGui::GetStyle();
+		size = CalcWidgetSize(size, ImGui::GetFrameHeight() * 6);
+		ImGui::InvisibleButton(label, size);
+		const bool hovered = ImGui::IsItemHovered();
+		const ImVec2 frameMin = ImGui::GetItemRectMin();
+		const ImVec2 frameMax = ImGui::GetItemRectMax();
+		const ImVec2 innerMin(frameMin.x + style.FramePadding.x, frameMin.y + style.FramePadding.y);
+		const ImVec2 innerMax(frameMax.x - style.FramePadding.x, frameMax.y - style.FramePadding.y);
+		AddWidgetLabel(label);
+
+		ImDrawList* drawList = ImGui::GetWindowDrawList();
+		drawList->AddRectFilled(frameMin, frameMax, IM_COL32_BLACK, style.FrameRounding);
+		if(displayData.waveformColumns > 0){
+			if(waveformDirty){
+				updateTexture(waveformTexture, waveformPixels, displayData.waveform, displayData.waveformColumns, 256, displayData.waveformMax);
+				waveformDirty = false;
+			}
+			drawList->AddImage(GetImTextureID(waveformTexture), innerMin, innerMax, ImVec2(0, 0), ImVec2(1, 1), IM_COL32(120, 255, 120, 255));
+		}
+
+		// Graticule every 25%
+		const ImU32 lineColor = ImGui::GetColorU32(ImGuiCol_TextDisabled, 0.5f);
+		for(int line = 0; line <= 4; ++line){
+			const float y = std::round(innerMin.y + (innerMax.y - innerMin.y) * line / 4.0f);
+			drawList->AddLine(ImVec2(innerMin.x, y), ImVec2(innerMax.x, y), lineColor);
+		}
+		if(hovered && ImGui::BeginTooltip()){
+			const float level = (innerMax.y - ImGui::GetIO().MousePos.y) / (innerMax.y - innerMin.y);
+			ImGui::Text("Luma %d (%.0f%%)", std::max(0, std::min(255, (int)(level * 255 + 0.5f))), std::max(0.0f, std::min(100.0f, level * 100)));
+			ImGui::EndTooltip();
+		}
+		return hovered;
+	}
+
+	//--------------------------------------------------------------
+	bool ImageScopes::drawVectorscope(const char* label, float size){
+		swapResults();
+		const ImGuiStyle& style = ImGui::GetStyle();
+		if(size <= 0) size = std::min(ImGui::CalcItemWidth(), ImGui::GetFrameHeight() * 8);
+		ImGui::InvisibleButton(label, ImVec2(size, size));
+		const bool hovered = ImGui::IsItemHovered();
+		const ImVec2 frameMin = ImGui::GetItemRectMin();
+		const ImVec2 frameMax = ImGui::GetItemRectMax();
+		const ImVec2 innerMin(frameMin.x + style.FramePadding.x, frameMin.y + style.FramePadding.y);
+		const ImVec2 innerMax(frameMax.x - style.FramePadding.x, frameMax.y - style.FramePadding.y);
+		AddWidgetLabel(label);
+
+		ImDrawList* drawList = ImGui::GetWindowDrawList();
+		drawList->AddRectFilled(frameMin, frameMax, IM_COL32_BLACK, style.FrameRounding);
+		if(!displayData.vectorscope.empty()){
+			if(vectorscopeDirty){
+				updateTexture(vectorscopeTexture, vectorscopePixels, displayData.vectorscope, ScopeData::vectorscopeSize, ScopeData::vectorscopeSize, displayData.vectorscopeMax);
+				vectorscopeDirty = false;
+			}
+			drawList->AddImage(GetImTextureID(vectorscopeTexture), innerMin, innerMax, ImVec2(0, 0), ImVec2(1, 1), IM_COL32(120, 255, 120, 255));
+		}
+
+		// Graticule : axes and the 75% saturation circle (largest chroma of 75% color bars)
+		const ImU32 lineColor = ImGui::GetColorU32(ImGuiCol_TextDisabled, 0.5f);
+		const ImVec2 center((innerMin.x + innerMax.x) * 0.5f, (innerMin.y + innerMax.y) * 0.5f);
+		const float radius = (innerMax.x - innerMin.x) * 0.5f;
+		drawList->AddLine(ImVec2(innerMin.x, center.y), ImVec2(innerMax.x, center.y), lineColor);
+		drawList->AddLine(ImVec2(center.x, innerMin.y), ImVec2(center.x, innerMax.y), lineColor);
+		drawList->AddCircle(center, radius * 0.75f * (224.0f / 256.0f), lineColor);
+		return hovered;
+	}
+}
@@ -0,0 +1,119 @@
+#pragma once
+
+#include "ofPixels.h"
+#include "ofTexture.h"
+#include "imgui.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Histogram, waveform and vectorscope monitors of images (camera frames...).
+// - Analysis : one pass over the pixels, luma (BT.601) and chroma computed per row in branch-free loops (vectorized by the compiler),
+//   counted in interleaved sub-histograms to avoid store-to-load stalls on repeated values.
+// - ImageScopes can analyse on a worker thread : update() copies the pixels and returns, results are swapped in when ready (one frame late).
+// - Drawing : a histogram is a filled path and an outline per channel, waveform and vectorscope densities are uploaded to a texture and drawn as one image.
+// Usage :
+//   ofxImGui::AddHistogram(pixels); // Immediate, histogram only
+//   Or with a member ofxImGui::ImageScopes scopes; scopes.setThreaded(true);
+//   In update() : scopes.update(camera.getPixels());
+//   In draw() : scopes.drawHistogram("Histogram"); scopes.drawWaveform("Waveform"); scopes.drawVectorscope("Vectorscope");
+
+namespace ofxImGui
+{
+	struct ScopeData
+	{
+		enum Channel { Red = 0, Green, Blue, Luma, NumChannels };
+		std::uint32_t histogram[NumChannels][256];
+		std::uint32_t histogramMax = 0;
+
+		int waveformColumns = 0;             // Columns of the waveform (horizontal image positions)
+		std::vector<std::uint32_t> waveform; // Per luma (256 rows) and column
+		std::uint32_t waveformMax = 0;
+
+		static const int vectorscopeSize = 128;
+		std::vector<std::uint32_t> vectorscope; // Per Cr (rows) and Cb (columns)
+		std::uint32_t vectorscopeMax = 0;
+
+		bool hasColor = false;
+		std::uint64_t numPixels = 0; // Analysed
+	};
+
+	// Flags of the computed scopes
+	enum ScopeFlags_
+	{
+		ScopeFlags_Histogram   = 1 << 0,
+		ScopeFlags_Waveform    = 1 << 1,
+		ScopeFlags_Vectorscope = 1 << 2,
+		ScopeFlags_All = ScopeFlags_Histogram | ScopeFlags_Waveform | ScopeFlags_Vectorscope,
+	};
+	typedef int ScopeFlags;
+
+	// Analyses every step pixel on both axes
+	void ComputeScopes(const ofPixels& pixels, ScopeData& data, ScopeFlags flags = ScopeFlags_All, int step = 1, int waveformColumns = 256);
+
+	// Histogram of the pixels (red, green, blue and luma), computed and drawn immediately
+	bool AddHistogram(const ofPixels& pixels, ImVec2 size = ImVec2(0, 0));
+	bool AddHistogram(const char* label, const ScopeData& data, ImVec2 size = ImVec2(0, 0));
+
+	class ImageScopes
+	{
+	public:
+		ImageScopes();
+		~ImageScopes();
+
+		// Prevent making copies
+		ImageScopes(const ImageScopes&) = delete;
+		ImageScopes& operator=(const ImageScopes&) = delete;
+
+		void setThreaded(bool threaded);
+		bool isThreaded() const { return worker.joinable(); }
+		void setFlags(ScopeFlags _flags) { flags = _flags; }
+		void setStep(int _step) { step = _step > 0 ? _step : 1; } // Analyses 1 / step^2 of the pixels
+		void setWaveformColumns(int columns) { waveformColumns = columns > 0 ? columns : 1; }
+
+		// Analyses the pixels, or queues them for the worker (replacing pixels not analysed yet)
+		void update(const ofPixels& pixels);
+
+		bool drawHistogram(const char* label, ImVec2 size = ImVec2(0, 0));
+		bool drawWaveform(const char* label, ImVec2 size = ImVec2(0, 0));
+		bool drawVectorscope(const char* label, float size = 0);
+
+		// Latest results, swapped in by the draw functions
+		const ScopeData& getData();
+
+	private:
+		void workerLoop();
+		void stopWorker();
+		void swapResults();
+		static void updateTexture(ofTexture& texture, ofPixels& pixels, const std::vector<std::uint32_t>& density, int width, int height, std::uint32_t max);
+
+		ScopeFlags flags = ScopeFlags_All;
+		int step = 1;
+		int waveformColumns = 256;
+
+		// Results : drawn, and computed by the worker (swapped when ready)
+		ScopeData displayData;
+		ScopeData readyData;
+		bool hasReadyData = false;
+		bool waveformDirty = false;
+		bool vectorscopeDirty = false;
+
+		ofTexture waveformTexture;
+		ofTexture vectorscopeTexture;
+		ofPixels waveformPixels; // Log scaled densities
+		ofPixels vectorscopePixels;
+
+		std::thread worker;
+		std::mutex mutex;
+		std::condition_variable condition;
+		ofPixels pendingPixels;
+		bool hasPendingPixels = false;
+		ScopeFlags pendingFlags = ScopeFlags_All; // Settings of the pending pixels, the worker doesn't read the members set by the GUI thread
+		int pendingStep = 1;
+		int pendingColumns = 256;
+		bool quit = false;
+	};
+}
@@ -0,0 +1,261 @@
+#include "LogViewer.h"
+
+#include <cstring> // memchr, memcmp
+
+namespace ofxImGui
+{
+	//--------------------------------------------------------------
+	LogViewer::LogViewer(){
+		for(bool& visible : levelVisible) visible = true;
+	}
+
+	//--------------------------------------------------------------
+	const char* LogViewer::FindSubstring(const char* begin, const char* end, const char* needle, std::size_t needleLen){
+		if(needleLen == 0) return begin;
+		const char first = needle[0];
+		while((std::size_t)(end - begin) >= needleLen){
+			begin = (const char*)std::memchr(begin, first, (std::size_t)(end - begin) - needleLen + 1);
+			if(begin == nullptr) return nullptr;
+			if(std::memcmp(begin + 1, needle + 1, needleLen - 1) == 0) return begin;
+			++begin;
+		}
+		return nullptr;
+	}
+
+	//--------------------------------------------------------------
+	void LogViewer::setLevelVisible(ofLogLevel level, bool visible){
+		if(level < 0 || level >= OF_LOG_SILENT || levelVisible[level] == visible) return;
+		levelVisible[level] = visible;
+		rebuildFilter();
+	}
+
+	//--------------------------------------------------------------
+	bool LogViewer::isLevelVisible(ofLogLevel level) const {
+		return level >= 0 && level < OF_LOG_SILENT && levelVisible[level];
+	}
+
+	//--------------------------------------------------------------
+	void LogViewer::setModuleFilter(int moduleId){
+		if(moduleFilter == moduleId) return;
+		moduleFilter = moduleId;
+		rebuildFilter();
+	}
+
+	//--------------------------------------------------------------
+	void LogViewer::setSearch(const std::string& search){
+		std::size_t len = search.size() < sizeof(searchBuf) - 1 ? search.size() : sizeof(searchBuf) - 1;
+		std::memcpy(searchBuf, search.c_str(), len);
+		searchBuf[len] = '\0';
+		searchLen = len;
+		rebuildFilter();
+	}
+
+	//--------------------------------------------------------------
+	void LogViewer::clear(){
+		LoggerChannel::clear();
+		sync();
+	}
+
+	//--------------------------------------------------------------
+	std::size_t LogViewer::getNumLines() const {
+		return filteredLines.Size;
+	}
+
+	//--------------------------------------------------------------
+	bool LogViewer::matchesModule(const LoggerChannel::Entry& entry) const {
+		return moduleFilter < 0 || entry.moduleId == moduleFilter;
+	}
+
+	//--------------------------------------------------------------
+	// Note: call with increasing entries, the cursor remembers the next match so the buffer is scanned once.
+	bool LogViewer::matchesSearch(const LoggerChannel::Entry& entry, const char* buffer, const char* bufferEnd){
+		if(searchLen == 0) return true;
+		const char* lineBegin = buffer + entry.textBegin;
+		const char* lineEnd = buffer + entry.textEnd;
+		if(searchCursor == nullptr) return false; // No more matches
+		if(searchCursor < lineBegin){
+			searchCursor = FindSubstring(lineBegin, bufferEnd, searchBuf, searchLen);
+			if(searchCursor == nullptr) return false;
+		}
+		return searchCursor + searchLen <= lineEnd;
+	}
+
+	//--------------------------------------------------------------
+	void LogViewer::dropOldLines(std::size_t firstEntryIndex){
+		auto dropFront = [firstEntryIndex](ImVector<std::size_t>& lines){
+			int i = 0;
+			while(i < lines.Size && lines[i] < firstEntryIndex) ++i;
+			if(i > 0) lines.erase(lines.begin(), lines.begin() + i);
+		};
+		for(ImVector<std::size_t>& lines : levelLines) dropFront(lines);
+		dropFront(filteredLines);
+	}
+
+	//--------------------------------------------------------------
+	void LogViewer::sync(){
+		const ImGuiTextBuffer& log = LoggerChannel::getBuffer(); // Drains once per frame
+		const ImVector<LoggerChannel::Entry>& entries = LoggerChannel::getEntries();
+		const std::size_t first = LoggerChannel::getFirstEntryIndex();
+		const std::size_t end = first + entries.Size;
+		const char* buffer = log.begin();
+
+		// Entries were dropped from the view
+		if(numSynced < first || (!filteredLines.empty() && filteredLines[0] < first)){
+			dropOldLines(first);
+			if(numSynced < first) numSynced = first;
+		}
+		else if(numSynced > end){
+			// Should not happen, start over
+			for(ImVector<std::size_t>& lines : levelLines) lines.clear();
+			filteredLines.clear();
+			numSynced = first;
+		}
+
+		if(numSynced == end) return;
+
+		// Index the new entries
+		searchCursor = buffer + entries[(int)(numSynced - first)].textBegin;
+		if(searchLen > 0) searchCursor = FindSubstring(searchCursor, log.end(), searchBuf, searchLen);
+		for(std::size_t i = numSynced; i < end; ++i){
+			const LoggerChannel::Entry& entry = entries[(int)(i - first)];
+			if(entry.level < 0 || entry.level >= OF_LOG_SILENT) continue;
+			levelLines[entry.level].push_back(i);
+			if(levelVisible[entry.level] && matchesModule(entry) && matchesSearch(entry, buffer, log.end())){
+				filteredLines.push_back(i);
+			}
+		}
+		numSynced = end;
+	}
+
+	//--------------------------------------------------------------
+	// Merges the visible per-level lists (sorted), testing module and search on them only.
+	void LogViewer::rebuildFilter(){
+		filteredLines.resize(0);
+
+		// Note: entries drained here are indexed by the next sync()
+		const ImGuiTextBuffer& log = LoggerChannel::getBuffer();
+		const ImVector<LoggerChannel::Entry>& entries = LoggerChannel::getEntries();
+		const std::size_t first = LoggerChannel::getFirstEntryIndex();
+		const char* buffer = log.begin();
+		dropOldLines(first);
+
+		int cursors[OF_LOG_SILENT] = {};
+		searchCursor = buffer;
+		if(searchLen > 0) searchCursor = FindSubstring(buffer, log.end(), searchBuf, searchLen);
+
+		while(true){
+			// Pick the smallest next index among visible levels
+			int nextLevel = -1;
+			for(int l = 0; l < OF_LOG_SILENT; ++l){
+				if(!levelVisible[l] || cursors[l] >= levelLines[l].Size) continue;
+				if(nextLevel < 0 || levelLines[l][cursors[l]] < levelLines[nextLevel][cursors[nextLevel]]) nextLevel = l;
+			}
+			if(nextLevel < 0) break;
+
+			std::size_t index = levelLines[nextLevel][cursors[nextLevel]++];
+			if(index >= first + entries.Size) continue;
+			const LoggerChannel::Entry& entry = entries[(int)(index - first)];
+			if(matchesModule(entry) && matchesSearch(entry, buffer, log.end())){
+				filteredLines.push_back(index);
+			}
+		}
+	}
+
+	//--------------------------------------------------------------
+	bool LogViewer::draw(const char* title, bool* open, ImGuiWindowFlags flags){
+		if(!ImGui::Begin(title, open, flags)){
+			ImGui::End();
+			return false;
+		}
+		drawContents();
+		ImGui::End();
+		return true;
+	}
+
+	//--------------------------------------------------------------
+	void LogViewer::drawContents(){
+		sync();
+
+		if(showToolbar){
+			static const char* levelLabels[OF_LOG_SILENT] = { "Verbose", "Notice", "Warning", "Error", "Fatal" };
+			for(int l = 0; l < OF_LOG_SILENT; ++l){
+				if(l > 0) ImGui::SameLine();
+				bool visible = levelVisible[l];
+				if(ImGui::Checkbox(levelLabels[l], &visible)) setLevelVisible((ofLogLevel)l, visible);
+			}
+
+			ImGui::SetNextItemWidth(ImGui::GetFontSize() * 10);
+			std::string moduleLabel = moduleFilter < 0 ? "All modules" : LoggerChannel::getModuleName((std::uint16_t)moduleFilter);
+			if(ImGui::BeginCombo("##module", moduleLabel.empty() ? "(none)" : moduleLabel.c_str())){
+				if(ImGui::Selectable("All modules", moduleFilter < 0)) setModuleFilter(-1);
+				std::size_t numModules = LoggerChannel::getNumModules();
+				for(std::size_t m = 0; m < numModules; ++m){
+					std::string name = LoggerChannel::getModuleName((std::uint16_t)m);
+					ImGui::PushID((int)m);
+					if(ImGui::Selectable(name.empty() ? "(none)" : name.c_str(), moduleFilter == (int)m)) setModuleFilter((int)m);
+					ImGui::PopID();
+				}
+				ImGui::EndCombo();
+			}
+
+			ImGui::SameLine();
+			ImGui::SetNextItemWidth(ImGui::GetFontSize() * 12);
+			if(ImGui::InputTextWithHint("##search", "Search", searchBuf, sizeof(searchBuf))){
+				searchLen = std::strlen(searchBuf);
+				rebuildFilter();
+			}
+			ImGui::SameLine();
+			if(ImGui::Button("Clear")) clear();
+			ImGui::SameLine();
+			ImGui::Checkbox("Auto-scroll", &autoScroll);
+			ImGui::SameLine();
+			ImGui::TextDisabled("%d lines", filteredLines.Size);
+			if(LoggerChannel::getNumDropped() > 0){
+				ImGui::SameLine();
+				ImGui::TextDisabled("(%d dropped)", (int)LoggerChannel::getNumDropped());
+			}
+			ImGui::Separator();
+		}
+
+		if(ImGui::BeginChild("##logLines", ImVec2(0, 0), ImGuiChildFlags_None, ImGuiWindowFlags_HorizontalScrollbar)){
+			const char* buffer = LoggerChannel::getBuffer().begin();
+			const ImVector<LoggerChannel::Entry>& entries = LoggerChannel::getEntries();
+			const std::size_t first = LoggerChannel::getFirstEntryIndex();
+
+			static const ImU32 levelColors[OF_LOG_SILENT] = {
+				IM_COL32(150,150,150,255), // Verbose
+				0,                         // Notice : default text color
+				IM_COL32(255,200, 80,255), // Warning
+				IM_COL32(255, 90, 90,255), // Error
+				IM_COL32(255, 40, 40,255), // Fatal
+			};
+
+			ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(0, 0));
+			ImGuiListClipper clipper;
+			clipper.Begin(filteredLines.Size);
+			while(clipper.Step()){
+				for(int line = clipper.DisplayStart; line < clipper.DisplayEnd; ++line){
+					std::size_t index = filteredLines[line];
+					if(index < first || index >= first + entries.Size) continue;
+					const LoggerChannel::Entry& entry = entries[(int)(index - first)];
+					const char* lineBegin = buffer + entry.textBegin;
+					const char* lineEnd = buffer + entry.textEnd;
+					if(lineEnd > lineBegin && lineEnd[-1] == '\n') --lineEnd;
+
+					ImU32 color = levelColors[entry.level];
+					if(color) ImGui::PushStyleColor(ImGuiCol_Text, color);
+					ImGui::TextUnformatted(lineBegin, lineEnd);
+					if(color) ImGui::PopStyleColor();
+				}
+			}
+			clipper.End();
+			ImGui::PopStyleVar();
+
+			// Follow new lines when scrolled to the bottom
+			if(autoScroll && ImGui::GetScrollY() >= ImGui::GetScrollMaxY()){
+				ImGui::SetScrollHereY(1.0f);
+			}
+		}
+		ImGui::EndChild();
+	}
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "ofxImGuiLoggerChannel.h"
+
+#include <string>
+
+// A log viewer for ofxImGui::LoggerChannel, that scales to large logs.
+// - Only visible lines are submitted (ImGuiListClipper).
+// - Indexes are updated incrementally with new entries : per-level line lists, and the filtered lines list.
+//   Changing a filter rebuilds the filtered list from the per-level lists, never the whole log.
+// - The substring search scans the log buffer with memchr/memcmp (vectorized by most C libraries), once per rebuild.
+// Usage :
+//   In setup() : ofSetLoggerChannel(std::make_shared<ofxImGui::LoggerChannel>());
+//   In draw()  : logViewer.draw("Logs");
+
+namespace ofxImGui
+{
+	class LogViewer
+	{
+	public:
+		LogViewer();
+
+		// Draws in a window. Returns false if collapsed/closed.
+		bool draw(const char* title, bool* open = nullptr, ImGuiWindowFlags flags = ImGuiWindowFlags_None);
+		// Draws the toolbar and the lines within the current window.
+		void drawContents();
+
+		// Filters
+		void setLevelVisible(ofLogLevel level, bool visible);
+		bool isLevelVisible(ofLogLevel level) const;
+		void setModuleFilter(int moduleId); // -1 = all modules
+		void setSearch(const std::string& search);
+
+		// Clears the LoggerChannel
+		void clear();
+
+		std::size_t getNumLines() const; // Filtered line count
+
+		bool autoScroll = true;
+		bool showToolbar = true;
+
+		// Returns the first occurrence of needle in [begin,end), or nullptr.
+		static const char* FindSubstring(const char* begin, const char* end, const char* needle, std::size_t needleLen);
+
+	private:
+		void sync();
+		void rebuildFilter();
+		bool matchesModule(const LoggerChannel::Entry& entry) const;
+		bool matchesSearch(const LoggerChannel::Entry& entry, const char* buffer, const char* bufferEnd);
+		void dropOldLines(std::size_t firstEntryIndex);
+
+		// Absolute entry indexes (see LoggerChannel::getFirstEntryIndex())
+		ImVector<std::size_t> levelLines[OF_LOG_SILENT];
+		ImVector<std::size_t> filteredLines;
+		std::size_t numSynced = 0; // Absolute index of the next entry to index
+
+		bool levelVisible[OF_LOG_SILENT];
+		int moduleFilter = -1;
+		char searchBuf[256] = "";
+		std::size_t searchLen = 0;
+		const char* searchCursor = nullptr; // Next search match, while indexing
+	};
+}
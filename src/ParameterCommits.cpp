@@ -0,0 +1,138 @@
+#include "ParameterCommits.h"
+
+#include <chrono>
+
+namespace ofxImGui
+{
+	namespace
+	{
+		struct PolicyEntry
+		{
+			CommitPolicy policy;
+			float interval;
+		};
+
+		thread_local std::vector<PolicyEntry> commitPolicies;
+		thread_local ParameterCommitQueue* currentQueue = nullptr;
+
+		double getTime()
+		{
+			return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+		}
+	}
+
+	//--------------------------------------------------------------
+	void PushCommitPolicy(CommitPolicy policy, float interval){
+		auto& policies = commitPolicies;
+		if(policy == CommitInherited){
+			policies.push_back(policies.empty() ? PolicyEntry{ CommitImmediate, interval } : policies.back());
+		}
+		else {
+			policies.push_back(PolicyEntry{ policy, interval });
+		}
+	}
+
+	//--------------------------------------------------------------
+	void PopCommitPolicy(){
+		if(commitPolicies.empty()){
+			ofLogWarning("ofxImGui::PopCommitPolicy()") << "Unbalanced call, no policy was pushed.";
+			return;
+		}
+		commitPolicies.pop_back();
+	}
+
+	//--------------------------------------------------------------
+	CommitPolicy GetCommitPolicy(){
+		return commitPolicies.empty() ? CommitImmediate : commitPolicies.back().policy;
+	}
+
+	//--------------------------------------------------------------
+	float GetCommitInterval(){
+		return commitPolicies.empty() ? 0.f : commitPolicies.back().interval;
+	}
+
+	//--------------------------------------------------------------
+	ParameterCommitQueue::~ParameterCommitQueue(){
+		if(currentQueue == this) currentQueue = nullptr;
+	}
+
+	//--------------------------------------------------------------
+	bool ParameterCommitQueue::isPending(const void* object) const {
+		for(const PendingCommit& commit : pending){
+			if(commit.object == object) return true;
+		}
+		return false;
+	}
+
+	//--------------------------------------------------------------
+	void ParameterCommitQueue::queue(ofAbstractParameter& parameter, void (*notify)(ofAbstractParameter&), float interval, bool force){
+		const void* object = parameter.getInternalObject();
+		for(PendingCommit& commit : pending){
+			if(commit.object == object){
+				commit.force |= force;
+				return;
+			}
+		}
+		if(interval > maxInterval) maxInterval = interval;
+		pending.push_back(PendingCommit{ parameter.newReference(), object, notify, interval, force });
+	}
+
+	//--------------------------------------------------------------
+	void ParameterCommitQueue::flush(){
+		if(pending.empty() && lastCommitTimes.empty()) return;
+
+		const double now = getTime();
+		// Forgets the parameters which can commit again : the map doesn't grow with every parameter ever edited,
+		// and a parameter allocated at a freed address doesn't inherit its timestamp.
+		if(now - pruneTime >= maxInterval){
+			for(auto it = lastCommitTimes.begin(); it != lastCommitTimes.end();){
+				if(now - it->second >= maxInterval && !isPending(it->first)) it = lastCommitTimes.erase(it);
+				else ++it;
+			}
+			pruneTime = now;
+		}
+		if(pending.empty()) return;
+
+		flushing.swap(pending);
+		for(PendingCommit& commit : flushing){
+			double& lastTime = lastCommitTimes[commit.object];
+			if(commit.force || now - lastTime >= commit.interval){
+				lastTime = now;
+				commit.notify(*commit.parameter);
+			}
+			else {
+				pending.push_back(std::move(commit));
+			}
+		}
+		flushing.clear();
+	}
+
+	//--------------------------------------------------------------
+	ParameterCommitQueue* ParameterCommitQueue::getCurrent(){
+		return currentQueue;
+	}
+
+	//--------------------------------------------------------------
+	void ParameterCommitQueue::setCurrent(ParameterCommitQueue* queue){
+		currentQueue = queue;
+	}
+
+	//--------------------------------------------------------------
+	void QueueParameterCommit(ofAbstractParameter& parameter, void (*notify)(ofAbstractParameter&), bool force){
+		if(currentQueue == nullptr){
+			notify(parameter);
+			return;
+		}
+		currentQueue->queue(parameter, notify, GetCommitInterval(), force);
+	}
+
+	//--------------------------------------------------------------
+	void FlushParameterCommits(){
+		if(currentQueue != nullptr) currentQueue->flush();
+	}
+
+	//--------------------------------------------------------------
+	std::size_t GetNumPendingCommits(){
+		return currentQueue != nullptr ? currentQueue->size() : 0;
+	}
+}
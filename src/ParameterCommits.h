@@ -0,0 +1,116 @@
+#pragma once
+
+#include "ofParameter.h"
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+// Commit policies of the parameter widgets : when edits notify the ofParameter listeners.
+// - CommitImmediate : parameter.set() on every edit, each frame while dragging (default).
+// - CommitOnRelease : the value follows the widget silently, listeners are notified once when the widget is released.
+// - CommitRateLimited : same, plus notifications at most every commitInterval seconds while editing.
+// Deferred notifications are coalesced per parameter in the queue of the ofxImGuiContext, and flushed on the main thread
+// at Gui::end() (and by GuiFrameScheduler::buildFrames() once the jobs are done). Outside of a Gui frame, edits notify immediately.
+// Usage :
+//   settings.commitPolicy = ofxImGui::CommitOnRelease; // For the AddGroup() / ClippedGroup widgets
+//   Or per call :
+//   ofxImGui::PushCommitPolicy(ofxImGui::CommitRateLimited, 0.25f);
+//   ofxImGui::AddSlider(parameter);
+//   ofxImGui::PopCommitPolicy();
+
+namespace ofxImGui
+{
+	enum CommitPolicy : unsigned char
+	{
+		CommitImmediate = 0,
+		CommitOnRelease,
+		CommitRateLimited,
+		CommitInherited, // Settings default : keeps the current policy
+	};
+
+	// Per thread stack, CommitInherited keeps the current policy and interval.
+	void PushCommitPolicy(CommitPolicy policy, float interval = 0.1f);
+	void PopCommitPolicy();
+	CommitPolicy GetCommitPolicy();
+	float GetCommitInterval();
+
+	// Applies the current policy after the widget(s) editing value : edited when the value changed this frame,
+	// released when the edit ended (ImGui::IsItemDeactivatedAfterEdit(), or edited for one-shot widgets). Returns edited.
+	template<typename ParameterType>
+	bool CommitParameter(ofParameter<ParameterType>& parameter, const typename std::common_type<ParameterType>::type& value, bool edited, bool released);
+
+	// Deferred commits of the frames of a context, one per ofxImGuiContext.
+	// Gui makes it current while a frame is built : pending commits don't depend on the thread building the frame.
+	class ParameterCommitQueue
+	{
+	public:
+		~ParameterCommitQueue();
+
+		// Queues a notification of the current parameter value, coalesced with the pending ones. Forced commits ignore the rate limit.
+		void queue(ofAbstractParameter& parameter, void (*notify)(ofAbstractParameter&), float interval, bool force);
+		// Notifies the due parameters, rate-limited ones stay pending
+		void flush();
+		std::size_t size() const { return pending.size(); }
+
+		// Queue of the frame being built on the calling thread, set by Gui
+		static ParameterCommitQueue* getCurrent();
+		static void setCurrent(ParameterCommitQueue* queue);
+
+	private:
+		struct PendingCommit
+		{
+			std::shared_ptr<ofAbstractParameter> parameter; // Keeps it alive until notified
+			const void* object;
+			void (*notify)(ofAbstractParameter&);
+			float interval;
+			bool force;
+		};
+
+		bool isPending(const void* object) const;
+
+		std::vector<PendingCommit> pending;
+		std::vector<PendingCommit> flushing; // Swapped with pending : listeners can queue commits
+		std::unordered_map<const void*, double> lastCommitTimes; // By internal object
+		float maxInterval = 0.f; // Of the queued commits : older commit times don't delay anything
+		double pruneTime = 0;
+	};
+
+	// Queues to the current ParameterCommitQueue, notifies now without one
+	void QueueParameterCommit(ofAbstractParameter& parameter, void (*notify)(ofAbstractParameter&), bool force);
+	// Flushes the current ParameterCommitQueue. Gui does it at the end of each frame.
+	void FlushParameterCommits();
+	std::size_t GetNumPendingCommits();
+
+	template<typename ParameterType>
+	void NotifyParameter(ofAbstractParameter& parameter)
+	{
+		auto& typedParameter = static_cast<ofParameter<ParameterType>&>(parameter);
+		typedParameter.set(typedParameter.get());
+	}
+}
+
+//--------------------------------------------------------------
+template<typename ParameterType>
+bool ofxImGui::CommitParameter(ofParameter<ParameterType>& parameter, const typename std::common_type<ParameterType>::type& value, bool edited, bool released)
+{
+	const CommitPolicy policy = GetCommitPolicy();
+	if (policy == CommitImmediate)
+	{
+		if (edited) parameter.set(value);
+		return edited;
+	}
+
+	if (edited)
+	{
+		parameter.setWithoutEventNotifications(value);
+		if (policy == CommitRateLimited) QueueParameterCommit(parameter, &NotifyParameter<ParameterType>, false);
+	}
+	if (released)
+	{
+		QueueParameterCommit(parameter, &NotifyParameter<ParameterType>, true);
+	}
+	return edited;
+}
@@ -0,0 +1,190 @@
+#pragma once
+
+#include "imgui.h"
+#include "TimeSeries.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cfloat>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+// Lock-free single producer ring of samples, for plotting streams produced by other threads (audio, sensors...).
+// - The producer thread push()es, it never blocks nor waits : when the ring is full, the oldest samples are overwritten.
+// - GUI threads read copies of the latest samples (readLatest()) or of the new ones since their cursor (read()), without blocking the producer.
+//   Copies are validated after copying (seqlock) : samples overwritten during the copy are dropped, so a copy is always a consistent window.
+// - Producer indexes are on their own cache line, consumers only read them : no false sharing.
+// Usage :
+//   ofxImGui::SampleRing<float> ring(1 << 20); // Shared with the producer thread
+//   Producer thread : ring.push(samples, numSamples);
+//   In draw() : ofxImGui::PlotSampleRing("Audio", ring, 4096, ImVec2(0, 100));
+//   Or for the whole stream : ofxImGui::AppendSamples(timeSeries, ring, cursor); ofxImGui::PlotTimeSeries("Stream", timeSeries, view);
+
+namespace ofxImGui
+{
+	// Read position of a consumer
+	struct SampleRingCursor
+	{
+		std::uint64_t position = 0; // Next sample index
+		std::uint64_t lost = 0;     // Samples overwritten before being read
+	};
+
+	template<typename T>
+	class SampleRing
+	{
+		static_assert(std::is_trivially_copyable<T>::value, "ofxImGui::SampleRing : samples are copied with memcpy.");
+	public:
+		static constexpr std::size_t cacheLineSize = 64;
+
+		explicit SampleRing(std::size_t _capacity = 1 << 16); // Rounded up to a power of 2
+
+		// Prevent making copies
+		SampleRing(const SampleRing&) = delete;
+		SampleRing& operator=(const SampleRing&) = delete;
+
+		// Producer thread only
+		void push(const T& value);
+		void push(const T* values, std::size_t count);
+
+		// Any thread. Copies the latest samples (oldest first), returns the number of copied samples.
+		std::size_t readLatest(T* values, std::size_t count) const;
+		// Copies the samples since the cursor and moves it, returns the number of copied samples.
+		std::size_t read(SampleRingCursor& cursor, T* values, std::size_t maxCount) const;
+
+		std::uint64_t getNumPushed() const { return written.load(std::memory_order_acquire); }
+		std::size_t getCapacity() const { return capacity; }
+
+	private:
+		// Copies [first, first + count), returns the number of leading samples overwritten during the copy (removed from values)
+		std::size_t copy(std::uint64_t first, std::size_t count, T* values) const;
+
+		// Producer cache line
+		alignas(cacheLineSize) std::atomic<std::uint64_t> written{ 0 }; // Published samples
+		std::atomic<std::uint64_t> writing{ 0 }; // Published + being written
+		// Read-only after construction
+		alignas(cacheLineSize) std::unique_ptr<T[]> buffer;
+		std::size_t capacity;
+		std::size_t mask;
+	};
+
+	// Plots the latest samples with ImGui::PlotLines()
+	bool PlotSampleRing(const char* label, const SampleRing<float>& ring, std::size_t count, ImVec2 size = ImVec2(0, 0), float scaleMin = FLT_MAX, float scaleMax = FLT_MAX);
+	// Appends the new samples of the ring to a TimeSeries, returns the number of appended samples
+	std::size_t AppendSamples(TimeSeries& series, const SampleRing<float>& ring, SampleRingCursor& cursor);
+}
+
+//--------------------------------------------------------------
+template<typename T>
+ofxImGui::SampleRing<T>::SampleRing(std::size_t _capacity)
+{
+	capacity = 1;
+	while (capacity < _capacity) capacity <<= 1;
+	mask = capacity - 1;
+	buffer.reset(new T[capacity]());
+}
+
+//--------------------------------------------------------------
+template<typename T>
+void ofxImGui::SampleRing<T>::push(const T& value)
+{
+	push(&value, 1);
+}
+
+//--------------------------------------------------------------
+template<typename T>
+void ofxImGui::SampleRing<T>::push(const T* values, std::size_t count)
+{
+	std::uint64_t first = written.load(std::memory_order_relaxed);
+	if (count > capacity)
+	{
+		// Only the last samples fit
+		first += count - capacity;
+		values += count - capacity;
+		count = capacity;
+	}
+	const std::uint64_t end = first + count;
+	writing.store(end, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	const std::size_t start = (std::size_t)(first & mask);
+	const std::size_t firstPart = std::min(count, capacity - start);
+	std::memcpy(buffer.get() + start, values, firstPart * sizeof(T));
+	std::memcpy(buffer.get(), values + firstPart, (count - firstPart) * sizeof(T));
+
+	written.store(end, std::memory_order_release);
+}
+
+//--------------------------------------------------------------
+template<typename T>
+std::size_t ofxImGui::SampleRing<T>::copy(std::uint64_t first, std::size_t count, T* values) const
+{
+	const std::size_t start = (std::size_t)(first & mask);
+	const std::size_t firstPart = std::min(count, capacity - start);
+	std::memcpy(values, buffer.get() + start, firstPart * sizeof(T));
+	std::memcpy(values + firstPart, buffer.get(), (count - firstPart) * sizeof(T));
+
+	// Samples before the oldest one the producer could be writing over are valid
+	std::atomic_thread_fence(std::memory_order_acquire);
+	const std::uint64_t end = writing.load(std::memory_order_relaxed);
+	const std::uint64_t oldestValid = end > capacity ? end - capacity : 0;
+	if (oldestValid <= first) return 0;
+
+	const std::size_t overwritten = (std::size_t)std::min<std::uint64_t>(oldestValid - first, count);
+	std::memmove(values, values + overwritten, (count - overwritten) * sizeof(T));
+	return overwritten;
+}
+
+//--------------------------------------------------------------
+template<typename T>
+std::size_t ofxImGui::SampleRing<T>::readLatest(T* values, std::size_t count) const
+{
+	const std::uint64_t end = written.load(std::memory_order_acquire);
+	count = (std::size_t)std::min<std::uint64_t>(std::min<std::uint64_t>(count, capacity), end);
+	return count - copy(end - count, count, values);
+}
+
+//--------------------------------------------------------------
+template<typename T>
+std::size_t ofxImGui::SampleRing<T>::read(SampleRingCursor& cursor, T* values, std::size_t maxCount) const
+{
+	const std::uint64_t end = written.load(std::memory_order_acquire);
+	if (cursor.position + capacity < end)
+	{
+		cursor.lost += end - capacity - cursor.position;
+		cursor.position = end - capacity;
+	}
+	const std::size_t count = (std::size_t)std::min<std::uint64_t>(maxCount, end - cursor.position);
+	const std::size_t overwritten = copy(cursor.position, count, values);
+	cursor.lost += overwritten;
+	cursor.position += count;
+	return count - overwritten;
+}
+
+//--------------------------------------------------------------
+inline bool ofxImGui::PlotSampleRing(const char* label, const SampleRing<float>& ring, std::size_t count, ImVec2 size, float scaleMin, float scaleMax)
+{
+	static thread_local std::vector<float> samples; // Reused between frames
+	samples.resize(count);
+	const std::size_t numSamples = ring.readLatest(samples.data(), count);
+	ImGui::PlotLines(label, samples.data(), (int)numSamples, 0, nullptr, scaleMin, scaleMax, size);
+	return numSamples > 0;
+}
+
+//--------------------------------------------------------------
+inline std::size_t ofxImGui::AppendSamples(TimeSeries& series, const SampleRing<float>& ring, SampleRingCursor& cursor)
+{
+	// Up to the samples pushed now : a fast producer can't keep the GUI thread here
+	const std::uint64_t end = ring.getNumPushed();
+	float samples[1024];
+	std::size_t total = 0;
+	while (cursor.position < end)
+	{
+		const std::size_t count = ring.read(cursor, samples, (std::size_t)std::min<std::uint64_t>(1024, end - cursor.position));
+		series.append(samples, count);
+		total += count;
+	}
+	return total;
+}
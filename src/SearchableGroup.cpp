@@ -0,0 +1,333 @@
+#include "SearchableGroup.h"
+
+#include <cfloat>
+
+namespace ofxImGui
+{
+	namespace
+	{
+		std::uint32_t getTrigram(const std::string& text, std::size_t position){
+			return ((std::uint32_t)(unsigned char)text[position] << 16) | ((std::uint32_t)(unsigned char)text[position + 1] << 8) | (std::uint32_t)(unsigned char)text[position + 2];
+		}
+
+		void toLower(std::string& text){
+			// ASCII only, UTF-8 sequences are kept as is
+			for(char& c : text){
+				if(c >= 'A' && c <= 'Z') c = (char)(c - 'A' + 'a');
+			}
+		}
+
+		thread_local SearchableGroupStore* currentStore = nullptr;
+	}
+
+	//--------------------------------------------------------------
+	bool SearchableGroup::draw(ofParameterGroup& group, Settings& settings){
+		bool changed = false;
+		if(settings.windowBlock){
+			if(BeginTree(group, settings)){
+				changed = drawContents(group, settings);
+				EndTree(settings);
+			}
+		}
+		else {
+			if(BeginWindow(group.getName(), settings)){
+				changed = drawContents(group, settings);
+			}
+			EndWindow(settings);
+		}
+		return changed;
+	}
+
+	//--------------------------------------------------------------
+	bool SearchableGroup::drawContents(ofParameterGroup& group, Settings& settings){
+		ImGui::PushID(this);
+		ImGui::SetNextItemWidth(-FLT_MIN);
+		ImGui::InputTextWithHint("##Search", "Search parameters", filterBuffer, sizeof(filterBuffer));
+		ImGui::PopID();
+		update(group);
+
+		bool changed = false;
+		PushCommitPolicy(settings.commitPolicy, settings.commitInterval);
+		if(query.empty()){
+			for(auto& parameter : group){
+				changed |= AddParameter(*parameter, settings);
+			}
+		}
+		else {
+			if(numMatches == 0){
+				ImGui::TextDisabled("No match");
+			}
+			for(int child : nodes[0].children){
+				changed |= drawNode(child, settings, filterChanged);
+			}
+		}
+		PopCommitPolicy();
+		filterChanged = false;
+		return changed;
+	}
+
+	//--------------------------------------------------------------
+	bool SearchableGroup::drawNode(int index, Settings& settings, bool forceOpen){
+		if(!visible[index]) return false;
+		const Node& node = nodes[index];
+		if(!node.group){
+			return AddParameter(*node.parameter, settings);
+		}
+
+		// Same as BeginTree(), matching branches open when the filter changes
+		if(forceOpen) ImGui::SetNextItemOpen(true);
+		bool open;
+		if(settings.treeLevel == 0){
+			open = ImGui::TreeNodeEx(GetUniqueName(*node.group), ImGuiTreeNodeFlags_Framed | ImGuiTreeNodeFlags_NoAutoOpenOnLog);
+		}
+		else {
+			open = ImGui::TreeNode(GetUniqueName(*node.group));
+		}
+		if(!open) return false;
+		settings.treeLevel += 1;
+		PushUniqueNameScope();
+
+		bool changed = false;
+		for(int child : node.children){
+			changed |= drawNode(child, settings, forceOpen);
+		}
+		EndTree(settings);
+		return changed;
+	}
+
+	//--------------------------------------------------------------
+	void SearchableGroup::setFilter(const std::string& filter){
+		std::size_t length = filter.size() < sizeof(filterBuffer) - 1 ? filter.size() : sizeof(filterBuffer) - 1;
+		filter.copy(filterBuffer, length);
+		filterBuffer[length] = '\0';
+	}
+
+	//--------------------------------------------------------------
+	void SearchableGroup::invalidate(){
+		isDirty = true;
+	}
+
+	//--------------------------------------------------------------
+	void SearchableGroup::update(ofParameterGroup& group){
+		if(isDirty || group.getInternalObject() != groupObject){
+			rebuild(group);
+		}
+		else {
+			// Structural changes : only the alive groups are checked, and the changed ones indexed again
+			changedGroups.clear();
+			for(int index : groupNodes){
+				if(nodes[index].group->size() != nodes[index].groupSize){
+					changedGroups.push_back(index);
+				}
+			}
+			for(int index : changedGroups){
+				if(!nodes[index].alive) continue; // Removed with a changed parent
+				removeChildren(index);
+				addChildren(index, nodes[index].path);
+				matchesDirty = true;
+			}
+			if(numDeadNodes > nodes.size() / 2){
+				rebuild(group);
+			}
+		}
+
+		std::string filter = filterBuffer;
+		toLower(filter);
+		if(filter != query){
+			query = std::move(filter);
+			matchesDirty = true;
+			filterChanged = true;
+		}
+		if(matchesDirty){
+			search();
+		}
+	}
+
+	//--------------------------------------------------------------
+	void SearchableGroup::rebuild(ofParameterGroup& group){
+		nodes.clear();
+		groupNodes.clear();
+		postings.clear();
+		numParameters = 0;
+		numDeadNodes = 0;
+		groupObject = group.getInternalObject();
+
+		// The root is the window or tree : not part of the paths
+		auto root = std::make_shared<ofParameterGroup>(group); // Copies share the same parameters
+		nodes.emplace_back();
+		nodes[0].parameter = root;
+		nodes[0].group = root;
+		addChildren(0, "");
+
+		isDirty = false;
+		matchesDirty = true;
+	}
+
+	//--------------------------------------------------------------
+	int SearchableGroup::addNode(const std::shared_ptr<ofAbstractParameter>& parameter, int parent, const std::string& parentPath){
+		const int index = (int)nodes.size();
+		nodes.emplace_back();
+		{
+			Node& node = nodes.back();
+			node.parameter = parameter;
+			node.group = std::dynamic_pointer_cast<ofParameterGroup>(parameter);
+			node.parent = parent;
+			node.path = parentPath.empty() ? parameter->getName() : parentPath + "/" + parameter->getName();
+			toLower(node.path);
+		}
+
+		if(nodes[index].group){
+			addChildren(index, nodes[index].path);
+		}
+		else {
+			++numParameters;
+			const std::string& path = nodes[index].path;
+			for(std::size_t position = 0; position + 2 < path.size(); ++position){
+				std::vector<int>& posting = postings[getTrigram(path, position)];
+				if(posting.empty() || posting.back() != index) posting.push_back(index);
+			}
+		}
+		return index;
+	}
+
+	//--------------------------------------------------------------
+	void SearchableGroup::addChildren(int index, const std::string& path){
+		// Copies : nodes is reallocated while adding
+		std::shared_ptr<ofParameterGroup> group = nodes[index].group;
+		const std::string groupPath = path;
+		nodes[index].groupSize = group->size();
+		if(nodes[index].groupSlot < 0){
+			nodes[index].groupSlot = (int)groupNodes.size();
+			groupNodes.push_back(index);
+		}
+		for(auto& parameter : *group){
+			const int child = addNode(parameter, index, groupPath);
+			nodes[index].children.push_back(child);
+		}
+	}
+
+	//--------------------------------------------------------------
+	void SearchableGroup::removeChildren(int index){
+		for(int child : nodes[index].children){
+			Node& node = nodes[child];
+			if(node.group){
+				removeChildren(child);
+				// Swap with the last alive group
+				const int last = groupNodes.back();
+				groupNodes[node.groupSlot] = last;
+				nodes[last].groupSlot = node.groupSlot;
+				groupNodes.pop_back();
+				node.groupSlot = -1;
+			}
+			else {
+				--numParameters;
+			}
+			// Dead nodes stay in the postings until the next rebuild
+			node.alive = false;
+			node.parameter.reset();
+			node.group.reset();
+			++numDeadNodes;
+		}
+		nodes[index].children.clear();
+	}
+
+	//--------------------------------------------------------------
+	void SearchableGroup::search(){
+		visible.assign(nodes.size(), 0);
+		numMatches = 0;
+		matchesDirty = false;
+		if(query.empty()) return;
+
+		auto verify = [this](int index){
+			const Node& node = nodes[index];
+			if(node.alive && !node.group && node.path.find(query) != std::string::npos){
+				markMatch(index);
+			}
+		};
+
+		if(query.size() < 3){
+			for(int index = 1; index < (int)nodes.size(); ++index){
+				verify(index);
+			}
+			return;
+		}
+
+		// Matches contain all the query trigrams : verify the candidates of the rarest one
+		const std::vector<int>* candidates = nullptr;
+		for(std::size_t position = 0; position + 2 < query.size(); ++position){
+			auto posting = postings.find(getTrigram(query, position));
+			if(posting == postings.end()) return;
+			if(candidates == nullptr || posting->second.size() < candidates->size()) candidates = &posting->second;
+		}
+		for(int index : *candidates){
+			verify(index);
+		}
+	}
+
+	//--------------------------------------------------------------
+	void SearchableGroup::markMatch(int index){
+		++numMatches;
+		// Parent groups are drawn too
+		while(index >= 0 && !visible[index]){
+			visible[index] = 1;
+			index = nodes[index].parent;
+		}
+	}
+
+	//--------------------------------------------------------------
+	void SearchableGroup::getMatches(std::vector<std::shared_ptr<ofAbstractParameter>>& matches) const {
+		for(std::size_t index = 0; index < visible.size(); ++index){
+			if(visible[index] && !nodes[index].group){
+				matches.push_back(nodes[index].parameter);
+			}
+		}
+	}
+
+	//--------------------------------------------------------------
+	SearchableGroupStore::~SearchableGroupStore(){
+		if(currentStore == this) currentStore = nullptr;
+	}
+
+	//--------------------------------------------------------------
+	SearchableGroup& SearchableGroupStore::get(const ofParameterGroup& group, int frame){
+		Entry& entry = groups[group.getInternalObject()];
+		if(!entry.searchableGroup){
+			entry.searchableGroup.reset(new SearchableGroup());
+		}
+		entry.lastFrame = frame;
+		return *entry.searchableGroup;
+	}
+
+	//--------------------------------------------------------------
+	void SearchableGroupStore::release(int frame){
+		for(auto entry = groups.begin(); entry != groups.end();){
+			if(entry->second.lastFrame + lifetime < frame) entry = groups.erase(entry);
+			else ++entry;
+		}
+	}
+
+	//--------------------------------------------------------------
+	void SearchableGroupStore::clear(){
+		groups.clear();
+	}
+
+	//--------------------------------------------------------------
+	SearchableGroupStore* SearchableGroupStore::getCurrent(){
+		return currentStore;
+	}
+
+	//--------------------------------------------------------------
+	void SearchableGroupStore::setCurrent(SearchableGroupStore* store){
+		currentStore = store;
+	}
+
+	//--------------------------------------------------------------
+	bool AddGroupSearchable(ofParameterGroup& group, Settings& settings){
+		SearchableGroupStore* store = SearchableGroupStore::getCurrent();
+		if(store == nullptr){
+			AddGroup(group, settings);
+			return false;
+		}
+		return store->get(group, ImGui::GetFrameCount()).draw(group, settings);
+	}
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "ImHelpers.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// ofParameterGroup with a search field : only the branches with matching parameters are drawn.
+// - Parameters are indexed once by lowercase path ("group/sub group/name"), with trigram posting lists.
+//   A query only verifies the parameters of its rarest trigram, shorter queries scan the paths.
+// - The index is maintained incrementally : when a (sub-)group size changes (checked each frame, per group),
+//   only that sub-group is indexed again. openFrameworks has no structural events, call invalidate() after renaming or replacing parameters.
+// - Matches are only searched again when the query or the index change.
+// Usage :
+//   ofxImGui::AddGroupSearchable(group, settings); // Like AddGroup(), one index per group and ofxImGuiContext
+//   Or keep your own : ofxImGui::SearchableGroup searchableGroup; searchableGroup.draw(group, settings);
+
+namespace ofxImGui
+{
+	class SearchableGroup
+	{
+	public:
+		// Like AddGroup() : in a new window, or as a tree when already in a window block. Returns true if a parameter changed.
+		bool draw(ofParameterGroup& group, Settings& settings);
+		// Draws the search field and the (matching) parameters in the current window
+		bool drawContents(ofParameterGroup& group, Settings& settings);
+
+		void setFilter(const std::string& filter);
+		std::string getFilter() const { return filterBuffer; }
+		// Updates the index and the matches of the current filter, done by draw()
+		void update(ofParameterGroup& group);
+		void invalidate();
+
+		std::size_t getNumParameters() const { return numParameters; }
+		std::size_t getNumMatches() const { return numMatches; } // Of the current filter
+		std::size_t getNumTrigrams() const { return postings.size(); }
+		// Appends the matching parameters of the current filter
+		void getMatches(std::vector<std::shared_ptr<ofAbstractParameter>>& matches) const;
+
+	private:
+		struct Node {
+			std::shared_ptr<ofAbstractParameter> parameter;
+			std::shared_ptr<ofParameterGroup> group; // Set for groups
+			std::string path; // Lowercase, without the root group
+			std::vector<int> children;
+			std::size_t groupSize = 0; // When indexed
+			int parent = -1;
+			int groupSlot = -1; // In groupNodes, while alive
+			bool alive = true;
+		};
+
+		void rebuild(ofParameterGroup& group);
+		int addNode(const std::shared_ptr<ofAbstractParameter>& parameter, int parent, const std::string& parentPath);
+		void addChildren(int index, const std::string& path);
+		void removeChildren(int index);
+		void search();
+		void markMatch(int index);
+		bool drawNode(int index, Settings& settings, bool forceOpen);
+
+		std::vector<Node> nodes; // nodes[0] is the root group, removed nodes stay dead until the next rebuild
+		std::vector<int> groupNodes; // Indexes of the alive groups, checked for structural changes each frame
+		std::vector<int> changedGroups;
+		std::unordered_map<std::uint32_t, std::vector<int>> postings; // Trigram -> node indexes, ascending
+		std::vector<unsigned char> visible; // Per node, for the current matches
+		const void* groupObject = nullptr;
+		std::size_t numParameters = 0;
+		std::size_t numDeadNodes = 0;
+		std::size_t numMatches = 0;
+		char filterBuffer[128] = "";
+		std::string query; // Lowercase filter of the matches
+		bool isDirty = true;
+		bool matchesDirty = true;
+		bool filterChanged = false;
+	};
+
+	// Searchable groups of AddGroupSearchable(), one store per ofxImGuiContext.
+	// Gui makes it current while a frame is built, and releases the groups which weren't drawn for a few seconds.
+	class SearchableGroupStore
+	{
+	public:
+		~SearchableGroupStore();
+
+		SearchableGroup& get(const ofParameterGroup& group, int frame); // Created on first use
+		void release(int frame); // Releases the groups not drawn since frame - lifetime
+		void clear();
+		std::size_t size() const { return groups.size(); }
+
+		// Store of the frame being built on the calling thread, set by Gui
+		static SearchableGroupStore* getCurrent();
+		static void setCurrent(SearchableGroupStore* store);
+
+		static const int lifetime = 300; // Frames
+
+	private:
+		struct Entry {
+			std::unique_ptr<SearchableGroup> searchableGroup;
+			int lastFrame = 0;
+		};
+		std::unordered_map<const void*, Entry> groups; // By internal object
+	};
+
+	// Draws the group with the SearchableGroup of the current ofxImGuiContext for this group.
+	// Outside of a Gui frame, draws it with AddGroup() (without search field) and returns false.
+	bool AddGroupSearchable(ofParameterGroup& group, Settings& settings);
+}
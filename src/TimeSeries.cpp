@@ -0,0 +1,200 @@
+#include "TimeSeries.h"
+
+#include "ImHelpers.h" // CalcWidgetSize(), AddWidgetLabel()
+
+#include <algorithm>
+#include <cmath>
+
+namespace ofxImGui
+{
+	namespace
+	{
+		inline void merge(ImVec2& range, float value){
+			if(value < range.x) range.x = value;
+			if(value > range.y) range.y = value;
+		}
+
+		inline void merge(ImVec2& range, const ImVec2& other){
+			if(other.x < range.x) range.x = other.x;
+			if(other.y > range.y) range.y = other.y;
+		}
+
+		// Column points of the plot, reused between frames
+		thread_local ImVector<ImVec2> plotPoints;
+	}
+
+	//--------------------------------------------------------------
+	void TimeSeries::append(float value){
+		std::size_t index = samples.size();
+		samples.push_back(value);
+
+		// Update the block containing the sample on each level, adding a top level when the current top has 2 elements
+		for(std::size_t level = 1; getLevelSize(level - 1) > 1; ++level){
+			const std::size_t parent = index >> blockShift;
+			if(level - 1 == levels.size()){
+				levels.emplace_back();
+				const std::size_t below = getLevelSize(level - 1);
+				std::vector<ImVec2>& blocks = levels.back();
+				for(std::size_t i = 0; i < below; ++i){
+					const ImVec2 range = level == 1 ? ImVec2(samples[i], samples[i]) : levels[level - 2][i];
+					if((i >> blockShift) == blocks.size()) blocks.push_back(range);
+					else merge(blocks.back(), range);
+				}
+			}
+			else {
+				std::vector<ImVec2>& blocks = levels[level - 1];
+				if(parent == blocks.size()) blocks.push_back(ImVec2(value, value));
+				else merge(blocks.back(), value);
+			}
+			index = parent;
+		}
+	}
+
+	//--------------------------------------------------------------
+	void TimeSeries::append(const float* values, std::size_t count){
+		samples.reserve(samples.size() + count);
+		for(std::size_t i = 0; i < count; ++i){
+			append(values[i]);
+		}
+	}
+
+	//--------------------------------------------------------------
+	void TimeSeries::reserve(std::size_t count){
+		samples.reserve(count);
+	}
+
+	//--------------------------------------------------------------
+	void TimeSeries::clear(){
+		samples.clear();
+		levels.clear();
+	}
+
+	//--------------------------------------------------------------
+	int TimeSeries::getLevel(double samplesPerBlock, std::size_t& blockSize) const {
+		int level = 0;
+		blockSize = 1;
+		while(level + 1 < getNumLevels() && (double)(blockSize << blockShift) <= samplesPerBlock){
+			blockSize <<= blockShift;
+			++level;
+		}
+		return level;
+	}
+
+	//--------------------------------------------------------------
+	ImVec2 TimeSeries::getRange(int level, std::size_t first, std::size_t count) const {
+		ImVec2 range(FLT_MAX, -FLT_MAX);
+		const std::size_t last = std::min(first + count, getLevelSize(level));
+		if(level == 0){
+			for(std::size_t i = first; i < last; ++i) merge(range, samples[i]);
+		}
+		else {
+			const std::vector<ImVec2>& blocks = levels[level - 1];
+			for(std::size_t i = first; i < last; ++i) merge(range, blocks[i]);
+		}
+		return range;
+	}
+
+	//--------------------------------------------------------------
+	bool PlotTimeSeries(const char* label, const TimeSeries& series, TimeSeriesView& view, ImVec2 size){
+		const ImGuiStyle& style = ImGui::GetStyle();
+		size = CalcWidgetSize(size, ImGui::GetFrameHeight() * 4);
+
+		ImGui::InvisibleButton(label, size);
+		ImGui::SetItemKeyOwner(ImGuiKey_MouseWheelY); // Zooms instead of scrolling the window
+		const bool hovered = ImGui::IsItemHovered();
+		const bool active = ImGui::IsItemActive();
+		const ImVec2 frameMin = ImGui::GetItemRectMin();
+		const ImVec2 frameMax = ImGui::GetItemRectMax();
+		const ImVec2 innerMin(frameMin.x + style.FramePadding.x, frameMin.y + style.FramePadding.y);
+		const ImVec2 innerMax(frameMax.x - style.FramePadding.x, frameMax.y - style.FramePadding.y);
+		const float innerWidth = innerMax.x - innerMin.x;
+
+		AddWidgetLabel(label);
+
+		ImDrawList* drawList = ImGui::GetWindowDrawList();
+		drawList->AddRectFilled(frameMin, frameMax, ImGui::GetColorU32(ImGuiCol_FrameBg), style.FrameRounding);
+
+		const std::size_t numSamples = series.size();
+		const int width = (int)innerWidth;
+		if(numSamples < 2 || width < 1 || innerMax.y <= innerMin.y){
+			return false;
+		}
+
+		// View
+		bool changed = false;
+		const ImGuiIO& io = ImGui::GetIO();
+		double length = view.length > 0 ? std::min(view.length, (double)numSamples) : (double)numSamples;
+		double start = view.follow ? numSamples - length : view.start;
+		if(hovered && io.MouseWheel != 0){
+			const double mouseSample = start + (io.MousePos.x - innerMin.x) / innerWidth * length;
+			const double newLength = std::max(2.0, std::min((double)numSamples, length * std::pow(0.8, (double)io.MouseWheel)));
+			start = mouseSample - (mouseSample - start) * newLength / length;
+			length = newLength;
+			changed = true;
+		}
+		if(active && ImGui::IsMouseDragging(ImGuiMouseButton_Left, 0.0f) && io.MouseDelta.x != 0){
+			start -= io.MouseDelta.x / innerWidth * length;
+			changed = true;
+		}
+		start = std::max(0.0, std::min(start, numSamples - length));
+		if(hovered && ImGui::IsMouseDoubleClicked(ImGuiMouseButton_Left)){
+			start = 0;
+			length = (double)numSamples;
+			changed = true;
+		}
+		if(changed){
+			view.length = length < numSamples ? length : 0;
+			view.follow = start + length >= numSamples;
+		}
+		view.start = start;
+
+		// Min and max of each pixel column, from the level with blocks of at most a column
+		const double samplesPerPixel = length / width;
+		const std::vector<float>& samples = series.getSamples();
+		ImVec2 range(FLT_MAX, -FLT_MAX);
+		plotPoints.resize(0);
+		if(samplesPerPixel < 1){
+			const std::size_t first = (std::size_t)start;
+			const std::size_t last = std::min(numSamples - 1, (std::size_t)std::ceil(start + length));
+			for(std::size_t i = first; i <= last; ++i){
+				plotPoints.push_back(ImVec2(innerMin.x + (float)((i - start) / samplesPerPixel), samples[i]));
+				merge(range, samples[i]);
+			}
+		}
+		else {
+			std::size_t blockSize;
+			const int level = series.getLevel(samplesPerPixel, blockSize);
+			plotPoints.reserve(width * 2);
+			for(int column = 0; column < width; ++column){
+				const double columnStart = start + column * samplesPerPixel;
+				const std::size_t first = (std::size_t)columnStart;
+				const std::size_t last = std::max(first + 1, std::min(numSamples, (std::size_t)std::ceil(columnStart + samplesPerPixel)));
+				const std::size_t firstBlock = first / blockSize;
+				const ImVec2 columnRange = series.getRange(level, firstBlock, (last + blockSize - 1) / blockSize - firstBlock);
+				const float x = innerMin.x + column + 0.5f;
+				plotPoints.push_back(ImVec2(x, columnRange.x));
+				plotPoints.push_back(ImVec2(x, columnRange.y));
+				merge(range, columnRange);
+			}
+		}
+
+		// Values to pixels
+		const float scaleMin = view.scaleMin != FLT_MAX ? view.scaleMin : range.x;
+		const float scaleMax = view.scaleMax != FLT_MAX ? view.scaleMax : range.y;
+		const float scale = scaleMax > scaleMin ? (innerMax.y - innerMin.y) / (scaleMax - scaleMin) : 0.0f;
+		const float middle = (innerMin.y + innerMax.y) * 0.5f;
+		for(ImVec2& point : plotPoints){
+			point.y = scale > 0 ? innerMax.y - (point.y - scaleMin) * scale : middle;
+		}
+
+		drawList->PushClipRect(innerMin, innerMax, true);
+		drawList->AddPolyline(plotPoints.Data, plotPoints.Size, ImGui::GetColorU32(ImGuiCol_PlotLines), ImDrawFlags_None, 1.0f);
+		drawList->PopClipRect();
+
+		if(hovered && !active){
+			const std::size_t sample = std::min(numSamples - 1, (std::size_t)(start + (io.MousePos.x - innerMin.x) / innerWidth * length));
+			ImGui::SetTooltip("%llu: %g", (unsigned long long)sample, samples[sample]);
+		}
+		return changed;
+	}
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "imgui.h"
+
+#include <cfloat>
+#include <cstddef>
+#include <vector>
+
+// Plots of long sample streams (millions of samples), where ImGui::PlotLines() would draw every sample.
+// - TimeSeries keeps the samples and a min/max pyramid : each level stores the min and max of blocks of 4 blocks of the previous level.
+//   It's updated as samples are appended, in O(levels) per sample, and takes 2/3 of the samples memory.
+// - PlotTimeSeries() picks the level matching the zoom in O(log n), and draws the min and max of each pixel column (2 points per pixel).
+//   Zoomed in under a sample per pixel, the samples are drawn as is.
+// - Mouse wheel zooms around the cursor, dragging pans, double-click shows all samples again.
+// Usage :
+//   ofxImGui::TimeSeries series; // Member of your ofApp
+//   ofxImGui::TimeSeriesView view;
+//   In update() : series.append(sensorValue);
+//   In draw() : ofxImGui::PlotTimeSeries("Sensor", series, view, ImVec2(0, 200));
+
+namespace ofxImGui
+{
+	class TimeSeries
+	{
+	public:
+		void append(float value);
+		void append(const float* values, std::size_t count);
+		void reserve(std::size_t count);
+		void clear();
+
+		std::size_t size() const { return samples.size(); }
+		const std::vector<float>& getSamples() const { return samples; }
+		int getNumLevels() const { return 1 + (int)levels.size(); } // Including the samples
+		// Level of blocks covering at most samplesPerBlock samples, with its block size
+		int getLevel(double samplesPerBlock, std::size_t& blockSize) const;
+		// Min (x) and max (y) of the elements in [first, first + count) of a level
+		ImVec2 getRange(int level, std::size_t first, std::size_t count) const;
+		std::size_t getLevelSize(int level) const { return level == 0 ? samples.size() : levels[level - 1].size(); }
+
+		static const int blockShift = 2; // 4 blocks per block of the next level
+
+	private:
+		std::vector<float> samples;
+		std::vector<std::vector<ImVec2>> levels; // levels[0] : blocks of 4 samples
+	};
+
+	struct TimeSeriesView
+	{
+		double start = 0;   // First visible sample
+		double length = 0;  // Visible samples, 0 for all
+		bool follow = true; // Shows the last samples when zoomed
+		float scaleMin = FLT_MAX; // FLT_MAX : fit to the visible samples
+		float scaleMax = FLT_MAX;
+	};
+
+	// Returns true when the view changed (zoom, pan)
+	bool PlotTimeSeries(const char* label, const TimeSeries& series, TimeSeriesView& view, ImVec2 size = ImVec2(0, 0));
+}
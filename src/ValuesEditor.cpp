@@ -0,0 +1,224 @@
+#include "ValuesEditor.h"
+
+#include <cfloat>
+#include <cstdio>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+	#include <xmmintrin.h>
+	#define OFXIMGUI_VALUES_EDITOR_SSE
+#endif
+
+namespace ofxImGui
+{
+	namespace
+	{
+		// Operand repeated over 12 floats : whole elements of 1 to 4 components, and 3 SIMD registers
+		const int patternSize = 12;
+
+		template<ValuesEditor::Operation operation>
+		inline float applyScalar(float value, float operand){
+			return operation == ValuesEditor::Offset ? value + operand : operation == ValuesEditor::Scale ? value * operand : operand;
+		}
+
+#ifdef OFXIMGUI_VALUES_EDITOR_SSE
+		template<ValuesEditor::Operation operation>
+		inline __m128 applySimd(__m128 values, __m128 operand){
+			return operation == ValuesEditor::Offset ? _mm_add_ps(values, operand) : operation == ValuesEditor::Scale ? _mm_mul_ps(values, operand) : operand;
+		}
+#endif
+
+		// Applies the operation to count floats, starting on an element boundary
+		template<ValuesEditor::Operation operation>
+		void applyRun(float* values, std::size_t count, const float* pattern){
+			std::size_t i = 0;
+#ifdef OFXIMGUI_VALUES_EDITOR_SSE
+			const __m128 operand0 = _mm_loadu_ps(pattern);
+			const __m128 operand1 = _mm_loadu_ps(pattern + 4);
+			const __m128 operand2 = _mm_loadu_ps(pattern + 8);
+			for(; i + patternSize <= count; i += patternSize){
+				_mm_storeu_ps(values + i,     applySimd<operation>(_mm_loadu_ps(values + i),     operand0));
+				_mm_storeu_ps(values + i + 4, applySimd<operation>(_mm_loadu_ps(values + i + 4), operand1));
+				_mm_storeu_ps(values + i + 8, applySimd<operation>(_mm_loadu_ps(values + i + 8), operand2));
+			}
+#else
+			// Fixed size inner loop : vectorized by the compiler
+			for(; i + patternSize <= count; i += patternSize){
+				for(int j = 0; j < patternSize; ++j){
+					values[i + j] = applyScalar<operation>(values[i + j], pattern[j]);
+				}
+			}
+#endif
+			for(int j = 0; i < count; ++i, ++j){
+				values[i] = applyScalar<operation>(values[i], pattern[j]);
+			}
+		}
+
+		template<ValuesEditor::Operation operation>
+		void applySelection(const ImGuiSelectionBasicStorage& selection, float* values, std::size_t count, int components, const float* pattern){
+			if(selection.Size == 0){
+				applyRun<operation>(values, count * components, pattern);
+				return;
+			}
+			// Selected indexes are iterated in ascending order : apply by contiguous runs
+			ImGuiSelectionBasicStorage& storage = const_cast<ImGuiSelectionBasicStorage&>(selection); // GetNextSelectedItem() isn't const
+			void* iterator = nullptr;
+			ImGuiID index;
+			std::size_t runStart = 0, runEnd = 0;
+			while(storage.GetNextSelectedItem(&iterator, &index)){
+				if(index >= count) break;
+				if(index != runEnd){
+					if(runEnd > runStart) applyRun<operation>(values + runStart * components, (runEnd - runStart) * components, pattern);
+					runStart = index;
+				}
+				runEnd = (std::size_t)index + 1;
+			}
+			if(runEnd > runStart) applyRun<operation>(values + runStart * components, (runEnd - runStart) * components, pattern);
+		}
+	}
+
+	//--------------------------------------------------------------
+	bool ValuesEditor::draw(const char* name, std::vector<float>& values, float minValue, float maxValue){
+		return draw(name, values.data(), values.size(), 1, minValue, maxValue);
+	}
+
+#if OF_VERSION_MINOR >= 10
+	//--------------------------------------------------------------
+	bool ValuesEditor::draw(const char* name, std::vector<glm::vec2>& values, float minValue, float maxValue){
+		return draw(name, values.empty() ? nullptr : &values[0].x, values.size(), 2, minValue, maxValue);
+	}
+
+	//--------------------------------------------------------------
+	bool ValuesEditor::draw(const char* name, std::vector<glm::vec3>& values, float minValue, float maxValue){
+		return draw(name, values.empty() ? nullptr : &values[0].x, values.size(), 3, minValue, maxValue);
+	}
+
+	//--------------------------------------------------------------
+	bool ValuesEditor::draw(const char* name, std::vector<glm::vec4>& values, float minValue, float maxValue){
+		return draw(name, values.empty() ? nullptr : &values[0].x, values.size(), 4, minValue, maxValue);
+	}
+#endif
+
+	//--------------------------------------------------------------
+	bool ValuesEditor::draw(const char* name, std::vector<ofVec2f>& values, float minValue, float maxValue){
+		return draw(name, values.empty() ? nullptr : &values[0].x, values.size(), 2, minValue, maxValue);
+	}
+
+	//--------------------------------------------------------------
+	bool ValuesEditor::draw(const char* name, std::vector<ofVec3f>& values, float minValue, float maxValue){
+		return draw(name, values.empty() ? nullptr : &values[0].x, values.size(), 3, minValue, maxValue);
+	}
+
+	//--------------------------------------------------------------
+	bool ValuesEditor::draw(const char* name, std::vector<ofVec4f>& values, float minValue, float maxValue){
+		return draw(name, values.empty() ? nullptr : &values[0].x, values.size(), 4, minValue, maxValue);
+	}
+
+	//--------------------------------------------------------------
+	bool ValuesEditor::draw(const char* name, float* values, std::size_t count, int components, float minValue, float maxValue){
+		if(components < 1 || components > 4){
+			ofLogWarning("ValuesEditor::draw()") << "Unsupported number of components : " << components;
+			return false;
+		}
+
+		bool changed = false;
+		ImGui::PushID(name);
+		ImGui::TextUnformatted(name);
+		changed |= drawOperations(values, count, components);
+
+		static const char* columnNames[] = { "x", "y", "z", "w" };
+		const ImGuiTableFlags tableFlags = ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersOuter | ImGuiTableFlags_BordersV | ImGuiTableFlags_Resizable;
+		const float height = rowsHeight > 0 ? rowsHeight : ImGui::GetFrameHeightWithSpacing() * 17;
+		if(ImGui::BeginTable("##Values", components + 1, tableFlags, ImVec2(0, height))){
+			ImGui::TableSetupScrollFreeze(0, 1);
+			ImGui::TableSetupColumn("#", ImGuiTableColumnFlags_WidthFixed);
+			for(int component = 0; component < components; ++component){
+				ImGui::TableSetupColumn(components == 1 ? "value" : columnNames[component], ImGuiTableColumnFlags_WidthStretch);
+			}
+			ImGui::TableHeadersRow();
+
+			const bool bounded = minValue < maxValue;
+			const float speed = bounded ? (maxValue - minValue) * 0.001f : 0.01f;
+
+			ImGuiMultiSelectIO* multiSelect = ImGui::BeginMultiSelect(ImGuiMultiSelectFlags_ClearOnEscape | ImGuiMultiSelectFlags_BoxSelect1d, selection.Size, (int)count);
+			selection.ApplyRequests(multiSelect);
+
+			ImGuiListClipper clipper;
+			clipper.Begin((int)count);
+			if(multiSelect->RangeSrcItem != -1) clipper.IncludeItemByIndex((int)multiSelect->RangeSrcItem);
+			while(clipper.Step()){
+				for(int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row){
+					ImGui::TableNextRow();
+					ImGui::PushID(row);
+
+					// Index cell : selection of the row
+					ImGui::TableNextColumn();
+					char index[16];
+					std::snprintf(index, sizeof(index), "%d", row);
+					ImGui::SetNextItemSelectionUserData(row);
+					ImGui::Selectable(index, selection.Contains((ImGuiID)row), ImGuiSelectableFlags_SpanAllColumns | ImGuiSelectableFlags_AllowOverlap);
+
+					float* element = values + (std::size_t)row * components;
+					for(int component = 0; component < components; ++component){
+						ImGui::TableNextColumn();
+						ImGui::SetNextItemWidth(-FLT_MIN);
+						ImGui::PushID(component);
+						changed |= ImGui::DragFloat("##v", element + component, speed, minValue, maxValue, "%.4f", bounded ? ImGuiSliderFlags_AlwaysClamp : ImGuiSliderFlags_None);
+						ImGui::PopID();
+					}
+					ImGui::PopID();
+				}
+			}
+			clipper.End();
+
+			multiSelect = ImGui::EndMultiSelect();
+			selection.ApplyRequests(multiSelect);
+			ImGui::EndTable();
+		}
+		ImGui::PopID();
+		return changed;
+	}
+
+	//--------------------------------------------------------------
+	bool ValuesEditor::drawOperations(float* values, std::size_t count, int components){
+		static const char* operationNames[] = { "Offset", "Scale", "Fill" };
+		static const ImGuiDataType dataType = ImGuiDataType_Float;
+
+		if(selection.Size > 0){
+			ImGui::Text("%d / %d selected", selection.Size, (int)count);
+			ImGui::SameLine();
+			if(ImGui::SmallButton("Clear")) selection.Clear();
+		}
+		else {
+			ImGui::Text("%d values, no selection : operations apply to all", (int)count);
+		}
+
+		bool changed = false;
+		for(int operation = Offset; operation <= Fill; ++operation){
+			ImGui::PushID(operation);
+			if(ImGui::Button(operationNames[operation], ImVec2(ImGui::GetFontSize() * 4, 0))){
+				apply((Operation)operation, values, count, components, operands[operation]);
+				changed = count > 0;
+			}
+			ImGui::SameLine();
+			ImGui::SetNextItemWidth(-FLT_MIN);
+			ImGui::DragScalarN("##operand", dataType, operands[operation], components, 0.01f);
+			ImGui::PopID();
+		}
+		return changed;
+	}
+
+	//--------------------------------------------------------------
+	void ValuesEditor::apply(Operation operation, float* values, std::size_t count, int components, const float* operand) const {
+		if(values == nullptr || count == 0 || components < 1 || components > 4) return;
+
+		float pattern[patternSize];
+		for(int i = 0; i < patternSize; ++i){
+			pattern[i] = operand[i % components];
+		}
+		switch(operation){
+			case Offset: applySelection<Offset>(selection, values, count, components, pattern); break;
+			case Scale: applySelection<Scale>(selection, values, count, components, pattern); break;
+			case Fill: applySelection<Fill>(selection, values, count, components, pattern); break;
+		}
+	}
+}
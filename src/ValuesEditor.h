@@ -0,0 +1,53 @@
+#pragma once
+
+#include "ImHelpers.h"
+
+#include <cstddef>
+#include <vector>
+
+// Table editor for large vectors of float values (calibration points...), where AddValues() would build a widget per element.
+// - Rows are submitted with ImGuiListClipper : frame cost scales with the visible rows. Row widgets use integer IDs, no per-row label.
+// - Rows can be multi-selected (click, Ctrl/Shift+click, box-select, Ctrl+A), then offset, scaled or filled at once.
+//   Operations run in SIMD (SSE when available) over the contiguous runs of selected rows, or over all rows without selection.
+// Usage :
+//   ofxImGui::ValuesEditor editor; // Member of your ofApp, one per edited vector
+//   In draw(), in a window : editor.draw("Points", points); // std::vector<glm::vec3>
+//   Scripted : editor.apply(ofxImGui::ValuesEditor::Scale, &points[0].x, points.size(), 3, &factor.x);
+
+namespace ofxImGui
+{
+	class ValuesEditor
+	{
+	public:
+		enum Operation : unsigned char { Offset = 0, Scale, Fill };
+
+		// Returns true if a value changed (edited or by an operation). minValue == maxValue uses unbounded drags.
+		bool draw(const char* name, std::vector<float>& values, float minValue = 0, float maxValue = 0);
+#if OF_VERSION_MINOR >= 10
+		bool draw(const char* name, std::vector<glm::vec2>& values, float minValue = 0, float maxValue = 0);
+		bool draw(const char* name, std::vector<glm::vec3>& values, float minValue = 0, float maxValue = 0);
+		bool draw(const char* name, std::vector<glm::vec4>& values, float minValue = 0, float maxValue = 0);
+#endif
+		bool draw(const char* name, std::vector<ofVec2f>& values, float minValue = 0, float maxValue = 0);
+		bool draw(const char* name, std::vector<ofVec3f>& values, float minValue = 0, float maxValue = 0);
+		bool draw(const char* name, std::vector<ofVec4f>& values, float minValue = 0, float maxValue = 0);
+		// Interleaved values, components from 1 to 4
+		bool draw(const char* name, float* values, std::size_t count, int components, float minValue = 0, float maxValue = 0);
+
+		// Applies the operation to the selected elements, or to all without selection. operand has one value per component.
+		void apply(Operation operation, float* values, std::size_t count, int components, const float* operand) const;
+
+		std::size_t getNumSelected() const { return (std::size_t)selection.Size; }
+		bool isSelected(std::size_t index) const { return selection.Contains((ImGuiID)index); }
+		void setSelected(std::size_t index, bool selected) { selection.SetItemSelected((ImGuiID)index, selected); }
+		void clearSelection() { selection.Clear(); }
+
+		float rowsHeight = 0; // Height of the table, 0 for 16 rows
+
+	private:
+		bool drawOperations(float* values, std::size_t count, int components);
+
+		ImGuiSelectionBasicStorage selection; // By element index
+		float operands[3][4] = { { 0, 0, 0, 0 }, { 1, 1, 1, 1 }, { 0, 0, 0, 0 } }; // Per operation
+	};
+}
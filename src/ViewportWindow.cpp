@@ -0,0 +1,139 @@
+#include "ViewportWindow.h"
+
+#include "ImHelpers.h" // GetImTextureID(), CalcWidgetSize()
+#include "ofGraphics.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ofxImGui
+{
+	//--------------------------------------------------------------
+	void ViewportWindow::setup(DrawFunction _drawFunction, int _internalFormat, int _numSamples){
+		drawFunction = _drawFunction;
+		if(_internalFormat != internalFormat || _numSamples != numSamples){
+			internalFormat = _internalFormat;
+			numSamples = _numSamples;
+			allocatedWidth = allocatedHeight = 0; // Reallocated with the new settings
+		}
+	}
+
+	//--------------------------------------------------------------
+	bool ViewportWindow::draw(const char* name, bool* open, ImGuiWindowFlags flags){
+		ImGui::PushStyleVar(ImGuiStyleVar_WindowPadding, ImVec2(0, 0));
+		const bool visible = ImGui::Begin(name, open, flags | ImGuiWindowFlags_NoScrollbar | ImGuiWindowFlags_NoScrollWithMouse);
+		ImGui::PopStyleVar();
+		if(visible){
+			drawViewport("##Viewport");
+		}
+		else {
+			input = ViewportInput();
+		}
+		ImGui::End();
+		return visible;
+	}
+
+	//--------------------------------------------------------------
+	bool ViewportWindow::drawViewport(const char* id, ImVec2 size){
+		// 0 for all the available space
+		size = CalcWidgetSize(size, ImGui::GetContentRegionAvail());
+		if(size.x < 1 || size.y < 1){
+			input = ViewportInput();
+			return false;
+		}
+
+		// Captures the mouse : dragging doesn't move the window, the wheel doesn't scroll it
+		ImGui::InvisibleButton(id, size, ImGuiButtonFlags_MouseButtonLeft | ImGuiButtonFlags_MouseButtonRight | ImGuiButtonFlags_MouseButtonMiddle);
+		if(ImGui::IsItemHovered()){
+			ImGui::SetItemKeyOwner(ImGuiKey_MouseWheelY);
+		}
+		const ImVec2 itemMin = ImGui::GetItemRectMin();
+		const ImVec2 itemMax = ImGui::GetItemRectMax();
+		const ImVec2 framebufferScale = ImGui::GetWindowViewport()->FramebufferScale;
+		updateInput(itemMin, framebufferScale);
+		if(!ImGui::IsItemVisible()){
+			return false;
+		}
+
+		updateSize((int)std::round(size.x * framebufferScale.x), (int)std::round(size.y * framebufferScale.y));
+		if(drawFunction){
+			fbo.begin();
+			ofViewport(0, 0, width, height);
+			ofSetupScreen();
+			// Rows of the viewport in the FBO, as set by OF (flipped when rendering to FBOs)
+			GLint viewport[4];
+			glGetIntegerv(GL_VIEWPORT, viewport);
+			drawFunction(ofRectangle(0, 0, width, height));
+			fbo.end();
+			uvMin = ImVec2((float)viewport[0] / allocatedWidth, (float)viewport[1] / allocatedHeight);
+			uvMax = ImVec2((float)(viewport[0] + viewport[2]) / allocatedWidth, (float)(viewport[1] + viewport[3]) / allocatedHeight);
+		}
+		ImGui::GetWindowDrawList()->AddImage(GetImTextureID(fbo.getTexture()), itemMin, itemMax, uvMin, uvMax);
+		return true;
+	}
+
+	//--------------------------------------------------------------
+	int ViewportWindow::getBucket(int size) const{
+		if(powerOfTwo){
+			int bucket = 64;
+			while(bucket < size) bucket <<= 1;
+			return bucket;
+		}
+		return std::max(64, (size + 63) / 64 * 64);
+	}
+
+	//--------------------------------------------------------------
+	void ViewportWindow::updateSize(int contentWidth, int contentHeight){
+		width = contentWidth;
+		height = contentHeight;
+		int newWidth = allocatedWidth;
+		int newHeight = allocatedHeight;
+		if(width > allocatedWidth || height > allocatedHeight){
+			// Grows immediately, without shrinking the other axis
+			newWidth = std::max(allocatedWidth, getBucket(width));
+			newHeight = std::max(allocatedHeight, getBucket(height));
+			shrinkFrames = 0;
+		}
+		else if(getBucket(width) < allocatedWidth || getBucket(height) < allocatedHeight){
+			// Shrinks when a smaller bucket fitted for a while
+			if(++shrinkFrames > shrinkDelay){
+				newWidth = getBucket(width);
+				newHeight = getBucket(height);
+				shrinkFrames = 0;
+			}
+		}
+		else {
+			shrinkFrames = 0;
+		}
+		if(newWidth == allocatedWidth && newHeight == allocatedHeight) return;
+
+		ofFbo::Settings settings;
+		settings.width = newWidth;
+		settings.height = newHeight;
+		settings.internalformat = internalFormat;
+		settings.numSamples = numSamples;
+		settings.useDepth = true;
+		settings.textureTarget = GL_TEXTURE_2D; // For ImGui
+		fbo.allocate(settings);
+		allocatedWidth = newWidth;
+		allocatedHeight = newHeight;
+		++numAllocations;
+	}
+
+	//--------------------------------------------------------------
+	void ViewportWindow::updateInput(const ImVec2& origin, const ImVec2& framebufferScale){
+		const ImGuiIO& io = ImGui::GetIO();
+		input.hovered = ImGui::IsItemHovered();
+		input.active = ImGui::IsItemActive();
+		input.mouse = glm::vec2((io.MousePos.x - origin.x) * framebufferScale.x, (io.MousePos.y - origin.y) * framebufferScale.y);
+		const bool focused = input.hovered || input.active;
+		input.mouseDelta = focused ? glm::vec2(io.MouseDelta.x * framebufferScale.x, io.MouseDelta.y * framebufferScale.y) : glm::vec2(0, 0);
+		input.wheel = input.hovered ? io.MouseWheel : 0;
+		const bool deactivated = ImGui::IsItemDeactivated();
+		for(int button = 0; button < 3; ++button){
+			input.mouseDown[button] = focused && io.MouseDown[button];
+			input.mouseClicked[button] = input.hovered && ImGui::IsMouseClicked(button);
+			input.mouseReleased[button] = (input.hovered || deactivated) && ImGui::IsMouseReleased(button);
+		}
+	}
+}
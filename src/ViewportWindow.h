@@ -0,0 +1,79 @@
+#pragma once
+
+#include "ofFbo.h"
+#include "ofRectangle.h"
+#include "imgui.h"
+
+#include <functional>
+
+// Dockable window showing a scene rendered into an ofFbo (3D views, previews...).
+// - The FBO is only reallocated on real size changes : it grows to size buckets (powers of 2 by default, or multiples of 64),
+//   and shrinks to a smaller bucket after the content stayed small for a number of frames. Resizing or docking the window doesn't reallocate every frame.
+// - The scene is rendered in the top-left part of the FBO matching the content size (in framebuffer pixels), only when the window is visible.
+// - Mouse input over the viewport is captured (the window doesn't move nor scroll), and exposed in viewport pixels by getInput().
+// - Rendering happens while building the GUI : call draw() from the GL thread (not from GuiFrameScheduler jobs).
+// Usage :
+//   ofxImGui::ViewportWindow sceneView; // Member of your ofApp
+//   In setup() : sceneView.setup([this](const ofRectangle& viewport){ ofClear(0); camera.begin(viewport); scene.draw(); camera.end(); });
+//   In draw() : sceneView.draw("Scene"); if(sceneView.getInput().hovered){ ... }
+
+namespace ofxImGui
+{
+	// Mouse state over a viewport, in viewport pixels (origin top-left)
+	struct ViewportInput
+	{
+		bool hovered = false;
+		bool active = false; // A button was pressed over the viewport and is held
+		glm::vec2 mouse = glm::vec2(0, 0);
+		glm::vec2 mouseDelta = glm::vec2(0, 0);
+		float wheel = 0;
+		bool mouseDown[3] = { false, false, false }; // Left, right, middle
+		bool mouseClicked[3] = { false, false, false };
+		bool mouseReleased[3] = { false, false, false };
+	};
+
+	class ViewportWindow
+	{
+	public:
+		typedef std::function<void(const ofRectangle& viewport)> DrawFunction;
+
+		// internalFormat and numSamples of the FBO, which always has a depth buffer
+		void setup(DrawFunction drawFunction, int internalFormat = GL_RGBA, int numSamples = 0);
+
+		// Window filling its content with the viewport. Returns true when visible.
+		bool draw(const char* name, bool* open = nullptr, ImGuiWindowFlags flags = 0);
+		// Viewport item in the current window, size as ImGui sizes (0 for all the available space). Returns true when rendered.
+		bool drawViewport(const char* id, ImVec2 size = ImVec2(0, 0));
+
+		const ViewportInput& getInput() const { return input; }
+		const ofFbo& getFbo() const { return fbo; }
+		// Rendered size, in pixels
+		int getWidth() const { return width; }
+		int getHeight() const { return height; }
+		int getNumAllocations() const { return numAllocations; }
+
+		void setPowerOfTwo(bool _powerOfTwo) { powerOfTwo = _powerOfTwo; }
+		void setShrinkDelay(int frames) { shrinkDelay = frames; }
+
+	private:
+		int getBucket(int size) const;
+		void updateSize(int contentWidth, int contentHeight);
+		void updateInput(const ImVec2& origin, const ImVec2& framebufferScale);
+
+		DrawFunction drawFunction;
+		ofFbo fbo;
+		int internalFormat = GL_RGBA;
+		int numSamples = 0;
+		int width = 0;
+		int height = 0;
+		int allocatedWidth = 0;
+		int allocatedHeight = 0;
+		int numAllocations = 0;
+		bool powerOfTwo = true;
+		int shrinkDelay = 60;
+		int shrinkFrames = 0; // Consecutive frames a smaller bucket would fit
+		ImVec2 uvMin = ImVec2(0, 0); // Rendered part of the FBO
+		ImVec2 uvMax = ImVec2(1, 1);
+		ViewportInput input;
+	};
+}
@@ -119,6 +119,14 @@
 // We don't need this, skips compiling useless functionality
 #define IMGUI_DISABLE_OBSOLETE_KEYIO
 
+// Threaded contexts : give each thread its own current context so that GuiFrameScheduler can build frames in parallel.
+// Defined in GuiFrameScheduler.cpp. See the "CONTEXT AND MEMORY ALLOCATORS" section of imgui.cpp.
+#ifdef OFXIMGUI_ENABLE_THREADED_CONTEXTS
+struct ImGuiContext;
+extern thread_local ImGuiContext* ofxImGuiThreadContext;
+#define GImGui ofxImGuiThreadContext
+#endif
+
 // 1.89.3 fix misnamed defines
 //#define PFNGLBINDTEXTUREPROC PFNGLBINDTEXTURESPROC
 //#define PFNGLDELETETEXTURESPROC PFNGLDELETETEXTURESSPROC
@@ -8,6 +8,7 @@
 
 // Flags that you can set :
 // #define OFXIMGUI_FORCE_OF_BACKEND --> force-use the simpler OF-based backend
+// #define OFXIMGUI_FORCE_NULL_BACKEND --> force-use the headless backend (no input, no rendering), for benchmarks
 // #define OFXIMGUI_GLFW_FIX_MULTICONTEXT_PRIMARY_VP 0|1 --> disable imgui glfw backend modification to allow multiple context for using imgui with multiple ofAppBaseWindows
 // #define OFXIMGUI_GLFW_FIX_MULTICONTEXT_SECONDARY_VP 0|1 --> Disable modifications to imgui_impl_glfw, disabling support for using ofxImGui in a multi-windowed-ofApp with viewports enabled.
 
@@ -46,6 +47,15 @@
 	#undef OFXIMGUI_DEBUG_MACROS
 #endif
 
+// OFXIMGUI_ENABLE_THREADED_CONTEXTS
+// Makes the current ImGui context thread-local, needed by GuiFrameScheduler to build frames in parallel.
+// Without it, the scheduler runs its jobs serially on the calling thread.
+#ifndef OFXIMGUI_ENABLE_THREADED_CONTEXTS
+	// Uncomment to enable by default
+	// Prefer defining it in your project macros, it has to be the same for all compilation units.
+	//#define OFXIMGUI_ENABLE_THREADED_CONTEXTS
+#endif
+
 // Helper for printing debug messages (only when DEBUG is on)
 #ifdef OFXIMGUI_DEBUG_MACROS
 	#define PRAGMA_MESSAGE(x) _Pragma(#x)
@@ -72,7 +82,12 @@
 #endif
 
 // Platform backend selection
-#if !defined(OFXIMGUI_FORCE_OF_BACKEND)
+#if defined(OFXIMGUI_FORCE_NULL_BACKEND)
+	OFXIMGUI_COMPILER_MESSAGE("ofxImGui is compiling with the headless null backend.")
+	#define OFXIMGUI_LOADED_BACKEND "Null"
+	#define OFXIMGUI_BACKEND_NULL
+
+#elif !defined(OFXIMGUI_FORCE_OF_BACKEND)
 
 	// Vulkan support ?
 	#if defined (OF_TARGET_API_VULKAN) && FALSE // tmp disabled, doesn't work either. Maybe rather implement OF backend with vulkan support
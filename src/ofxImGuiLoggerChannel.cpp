@@ -1,15 +1,335 @@
 #include "ofxImGuiLoggerChannel.h"
 
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <new> // std::nothrow
+#include <unordered_map>
+#include <vector>
+
+namespace {
+	// View side state, guarded by mutex : drain() is the single consumer of the ring
+	struct LoggerView {
+		std::recursive_mutex mutex;
+		ImGuiTextBuffer buffer;
+		ImVector<ofxImGui::LoggerChannel::Entry> entries;
+		std::size_t firstEntryIndex = 0;
+		int lastDrainFrame = -1;
+	};
+
+	LoggerView& getView(){
+		static LoggerView sView;
+		return sView;
+	}
+
+	// Module names, interned once. Lookups of a thread's last module don't lock.
+	struct ModuleTable {
+		std::mutex mutex;
+		std::vector<std::string> names { std::string() };
+		std::unordered_map<std::string, std::uint16_t> ids { { std::string(), 0 } };
+	};
+
+	ModuleTable& getModules(){
+		static ModuleTable sModules;
+		return sModules;
+	}
+
+	std::atomic<std::size_t> sMemoryCap { 2 * 1024 * 1024 };
+	std::atomic<std::size_t> sNumDropped { 0 };
+
+	double getLogTime(){
+		static const std::chrono::steady_clock::time_point sStart = std::chrono::steady_clock::now();
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - sStart).count();
+	}
+
+	std::size_t getRingCapacity(std::size_t memoryCap){
+		// Half of the cap, rounded down to a power of 2
+		std::size_t maxRecords = (memoryCap / 2) / ofxImGui::LoggerChannel::RecordSize;
+		std::size_t capacity = 2;
+		while(capacity * 2 <= maxRecords) capacity *= 2;
+		return capacity;
+	}
+}
+
 //--------------------------------------------------------------
+ofxImGui::LoggerChannel::Ring::Ring(std::size_t capacity) :
+	slots(new Slot[capacity]),
+	mask(capacity - 1),
+	enqueuePos(0),
+	dequeuePos(0)
+{
+	for(std::size_t i = 0; i < capacity; ++i){
+		slots[i].sequence.store(i, std::memory_order_relaxed);
+	}
+}
 
+//--------------------------------------------------------------
+ofxImGui::LoggerChannel::Ring::~Ring(){
+	while(const Record* record = beginPop()){
+		delete[] record->overflow;
+		endPop();
+	}
+}
+
+//--------------------------------------------------------------
+// Reserves a slot, returns nullptr when the ring is full.
+ofxImGui::LoggerChannel::Record* ofxImGui::LoggerChannel::Ring::beginPush(std::size_t& pos){
+	pos = enqueuePos.load(std::memory_order_relaxed);
+	while(true){
+		Slot& slot = slots[pos & mask];
+		std::size_t seq = slot.sequence.load(std::memory_order_acquire);
+		std::intptr_t diff = (std::intptr_t)seq - (std::intptr_t)pos;
+		if(diff == 0){
+			if(enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)){
+				return &slot.record;
+			}
+		}
+		else if(diff < 0){
+			return nullptr;
+		}
+		else {
+			pos = enqueuePos.load(std::memory_order_relaxed);
+		}
+	}
+}
+
+//--------------------------------------------------------------
+void ofxImGui::LoggerChannel::Ring::endPush(std::size_t pos){
+	slots[pos & mask].sequence.store(pos + 1, std::memory_order_release);
+}
+
+//--------------------------------------------------------------
+const ofxImGui::LoggerChannel::Record* ofxImGui::LoggerChannel::Ring::beginPop(){
+	Slot& slot = slots[dequeuePos & mask];
+	if(slot.sequence.load(std::memory_order_acquire) != dequeuePos + 1) return nullptr;
+	return &slot.record;
+}
+
+//--------------------------------------------------------------
+void ofxImGui::LoggerChannel::Ring::endPop(){
+	slots[dequeuePos & mask].sequence.store(dequeuePos + mask + 1, std::memory_order_release);
+	++dequeuePos;
+}
+
+//--------------------------------------------------------------
+std::unique_ptr<ofxImGui::LoggerChannel::Ring>& ofxImGui::LoggerChannel::getRingPtr(){
+	static std::unique_ptr<Ring> sRing;
+	return sRing;
+}
+
+//--------------------------------------------------------------
+ofxImGui::LoggerChannel::Ring& ofxImGui::LoggerChannel::getRing(){
+	static std::once_flag sRingInit;
+	std::call_once(sRingInit, [](){
+		if(!getRingPtr()) getRingPtr().reset(new Ring(getRingCapacity(sMemoryCap)));
+	});
+	return *getRingPtr();
+}
+
+//--------------------------------------------------------------
+void ofxImGui::LoggerChannel::setMemoryCap(std::size_t bytes){
+	std::lock_guard<std::recursive_mutex> lock(getView().mutex);
+	sMemoryCap = bytes;
+	drain();
+	getRingPtr().reset(new Ring(getRingCapacity(bytes)));
+}
+
+//--------------------------------------------------------------
+std::size_t ofxImGui::LoggerChannel::getMemoryCap(){
+	return sMemoryCap;
+}
+
+//--------------------------------------------------------------
+std::size_t ofxImGui::LoggerChannel::getNumDropped(){
+	return sNumDropped;
+}
+
+//--------------------------------------------------------------
+std::uint16_t ofxImGui::LoggerChannel::getModuleId(const std::string & module){
+	if(module.empty()) return 0;
+
+	thread_local std::string lastModule;
+	thread_local std::uint16_t lastModuleId = 0;
+	if(lastModuleId != 0 && module == lastModule) return lastModuleId;
+
+	ModuleTable& modules = getModules();
+	std::lock_guard<std::mutex> lock(modules.mutex);
+	auto found = modules.ids.find(module);
+	std::uint16_t id;
+	if(found != modules.ids.end()){
+		id = found->second;
+	}
+	else if(modules.names.size() < 0xFFFF){
+		id = (std::uint16_t)modules.names.size();
+		modules.names.push_back(module);
+		modules.ids.emplace(module, id);
+	}
+	else {
+		return 0; // Table full, log without module
+	}
+	lastModule = module;
+	lastModuleId = id;
+	return id;
+}
+
+//--------------------------------------------------------------
+std::string ofxImGui::LoggerChannel::getModuleName(std::uint16_t moduleId){
+	ModuleTable& modules = getModules();
+	std::lock_guard<std::mutex> lock(modules.mutex);
+	return moduleId < modules.names.size() ? modules.names[moduleId] : std::string();
+}
+
+//--------------------------------------------------------------
+std::size_t ofxImGui::LoggerChannel::getNumModules(){
+	ModuleTable& modules = getModules();
+	std::lock_guard<std::mutex> lock(modules.mutex);
+	return modules.names.size();
+}
+
+//--------------------------------------------------------------
+// Formats directly into the reserved slot, only longer messages allocate.
+void ofxImGui::LoggerChannel::pushRecord( ofLogLevel level, const std::string & module, const char* format, va_list args ){
+	std::uint16_t moduleId = getModuleId(module);
+
+	std::size_t pos;
+	Ring& ring = getRing();
+	Record* record = ring.beginPush(pos);
+	if(record == nullptr){
+		++sNumDropped;
+		return;
+	}
+
+	record->time = getLogTime();
+	record->level = (std::int32_t)level;
+	record->moduleId = moduleId;
+	record->overflow = nullptr;
+	va_list argsCopy;
+	va_copy(argsCopy, args);
+	int len = std::vsnprintf(record->message, MessageSize, format, args);
+	if(len < 0) len = 0;
+	if(len >= (int)MessageSize){
+		// Formatted again in full, the record keeps its truncated copy if the allocation fails
+		record->overflow = new (std::nothrow) char[len + 1];
+		if(record->overflow != nullptr) std::vsnprintf(record->overflow, len + 1, format, argsCopy);
+	}
+	va_end(argsCopy);
+	record->messageLength = (std::uint16_t)(len < (int)MessageSize ? len : (int)MessageSize - 1);
+	ring.endPush(pos);
+}
+
+//--------------------------------------------------------------
+std::size_t ofxImGui::LoggerChannel::drain(){
+	LoggerView& view = getView();
+	std::lock_guard<std::recursive_mutex> lock(view.mutex);
+	Ring& ring = getRing();
+
+	// Level names, ofGetLogLevelName() allocates
+	static std::string sLevelNames[OF_LOG_SILENT + 1];
+	if(sLevelNames[0].empty()){
+		for(int i = 0; i <= OF_LOG_SILENT; ++i) sLevelNames[i] = ofGetLogLevelName((ofLogLevel)i, true);
+	}
+
+	// Module names, cached by id to lock the table only once per new module
+	static std::vector<std::string> sModuleNames;
+
+	std::size_t numNew = 0;
+	while(const Record* record = ring.beginPop()){
+		if(record->moduleId >= sModuleNames.size()){
+			ModuleTable& modules = getModules();
+			std::lock_guard<std::mutex> lock(modules.mutex);
+			sModuleNames = modules.names;
+		}
+		const std::string& moduleName = record->moduleId < sModuleNames.size() ? sModuleNames[record->moduleId] : sModuleNames[0];
+		int level = (record->level >= 0 && record->level <= OF_LOG_SILENT) ? record->level : OF_LOG_NOTICE;
+
+		Entry entry;
+		entry.time = record->time;
+		entry.level = (ofLogLevel)level;
+		entry.moduleId = record->moduleId;
+		entry.textBegin = view.buffer.size();
+		view.buffer.appendf("[%s] %s: ", sLevelNames[level].c_str(), moduleName.c_str());
+		const char* message = record->overflow != nullptr ? record->overflow : record->message;
+		const std::size_t messageLength = record->overflow != nullptr ? std::strlen(record->overflow) : record->messageLength;
+		view.buffer.append(message, message + messageLength);
+		if(messageLength == 0 || message[messageLength - 1] != '\n') view.buffer.append("\n");
+		entry.textEnd = view.buffer.size();
+		view.entries.push_back(entry);
+
+		delete[] record->overflow;
+		ring.endPop();
+		++numNew;
+	}
+
+	// Enforce the view's half of the cap : drop the oldest half of the entries
+	if((std::size_t)view.buffer.Buf.capacity() + (std::size_t)view.entries.capacity() * sizeof(Entry) > sMemoryCap / 2 && view.entries.Size > 1){
+		int keepFrom = view.entries.Size / 2;
+		int textOffset = view.entries[keepFrom].textBegin;
+		int textSize = view.buffer.size() - textOffset;
+
+		ImGuiTextBuffer kept;
+		kept.Buf.reserve(textSize + 1);
+		kept.append(view.buffer.begin() + textOffset, view.buffer.end());
+		view.buffer.Buf.swap(kept.Buf);
+
+		ImVector<Entry> keptEntries;
+		keptEntries.reserve(view.entries.Size - keepFrom);
+		for(int i = keepFrom; i < view.entries.Size; ++i){
+			Entry entry = view.entries[i];
+			entry.textBegin -= textOffset;
+			entry.textEnd -= textOffset;
+			keptEntries.push_back(entry);
+		}
+		view.entries.swap(keptEntries);
+		view.firstEntryIndex += keepFrom;
+	}
+
+	return numNew;
+}
+
+//--------------------------------------------------------------
+void ofxImGui::LoggerChannel::clear(){
+	LoggerView& view = getView();
+	std::lock_guard<std::recursive_mutex> lock(view.mutex);
+	drain();
+	view.firstEntryIndex += view.entries.Size;
+	view.buffer.clear();
+	view.entries.clear();
+}
+
+//--------------------------------------------------------------
 ImGuiTextBuffer& ofxImGui::LoggerChannel::getBuffer(){
-	static ImGuiTextBuffer sLogBuffer; // static log buffer for logger channel
-	return sLogBuffer;
+	LoggerView& view = getView();
+	std::lock_guard<std::recursive_mutex> lock(view.mutex);
+	int frame = ImGui::GetCurrentContext() ? ImGui::GetFrameCount() : -1;
+	if(frame < 0 || frame != view.lastDrainFrame){
+		drain();
+		view.lastDrainFrame = frame;
+	}
+	return view.buffer;
 };
 
+//--------------------------------------------------------------
+const ImVector<ofxImGui::LoggerChannel::Entry>& ofxImGui::LoggerChannel::getEntries(){
+	return getView().entries;
+}
+
+//--------------------------------------------------------------
+std::size_t ofxImGui::LoggerChannel::getFirstEntryIndex(){
+	LoggerView& view = getView();
+	std::lock_guard<std::recursive_mutex> lock(view.mutex);
+	return view.firstEntryIndex;
+}
+
+//--------------------------------------------------------------
+std::unique_lock<std::recursive_mutex> ofxImGui::LoggerChannel::lockView(){
+	return std::unique_lock<std::recursive_mutex>(getView().mutex);
+}
+
 //--------------------------------------------------------------
 void ofxImGui::LoggerChannel::log( ofLogLevel level, const std::string & module, const std::string & message ){
-	getBuffer().appendf( "[%s] %s: %s\n", ofGetLogLevelName( level, true ).c_str(), module.c_str(), message.c_str() );
+	// Note: goes through the format variant so the message is written in place, "%s" avoids interpreting it.
+	log( level, module, "%s", message.c_str() );
 }
 
 void ofxImGui::LoggerChannel::log( ofLogLevel level, const std::string & module, const char* format, ... ){
@@ -20,8 +340,7 @@ void ofxImGui::LoggerChannel::log( ofLogLevel level, const std::string & module,
 }
 
 void ofxImGui::LoggerChannel::log( ofLogLevel level, const std::string & module, const char* format, va_list args ){
-	getBuffer().appendf( "[%s] %s: ", ofGetLogLevelName( level, true ).c_str(), module.c_str() );
-	getBuffer().appendfv( format, args );
+	pushRecord( level, module, format, args );
 }
 
 
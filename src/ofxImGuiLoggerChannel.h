@@ -3,22 +3,100 @@
 #include "imgui.h"
 #include "ofLog.h"
 
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
 namespace ofxImGui {
 
-/// \brief A logger channel that logs its messages to the console.
+/// \brief A logger channel that logs its messages to an ImGui text buffer.
+/// Thread safe : messages are pushed as fixed-size records into a bounded lock-free ring (multi-producer).
+/// They are drained into the view buffer once per ImGui frame, on the thread reading the view.
+/// When the ring is full, new messages are dropped (see getNumDropped()).
+/// Messages longer than a record spill to a heap allocation, owned by the record until it's drained.
 class LoggerChannel : public ofBaseLoggerChannel
 {
 public:
+	/// \brief A drained log message. Its text lives in getBuffer(), between textBegin and textEnd.
+	struct Entry {
+		double time; // Seconds since the channel was first used
+		ofLogLevel level;
+		std::uint16_t moduleId;
+		int textBegin;
+		int textEnd;
+	};
+
+	/// \brief Fixed-size record, written by the logging threads. Longer messages are allocated.
+	static constexpr std::size_t RecordSize = 256;
+	static constexpr std::size_t MessageSize = RecordSize - 24 - sizeof(char*); // Slot : sequence + header + message
 
+	/// \brief The view buffer, formatted as "[level] module: message\n". Drains pending records on first call of each frame.
 	static ImGuiTextBuffer & getBuffer();
+	/// \brief One entry per line of getBuffer(). Doesn't drain, call it after getBuffer() so both match.
+	static const ImVector<Entry> & getEntries();
+	/// \brief Absolute index of getEntries()[0]. Grows when old entries are dropped from the view, so indexes can be kept across drains.
+	static std::size_t getFirstEntryIndex();
+	/// \brief Moves pending records to the view. Called by getBuffer(). Returns the number of new entries.
+	static std::size_t drain();
+	static void clear();
+	/// \brief Draining and the view are guarded by a (recursive) mutex. When the logs are read by several threads (GuiFrameScheduler jobs),
+	/// hold it while using the references of getBuffer() and getEntries() : auto lock = ofxImGui::LoggerChannel::lockView();
+	static std::unique_lock<std::recursive_mutex> lockView();
+
+	/// \brief Memory cap in bytes, split between the pending records and the view. Default is 2MB.
+	/// Call it before installing the channel, resizing the ring while other threads log is not safe.
+	static void setMemoryCap(std::size_t bytes);
+	static std::size_t getMemoryCap();
+	/// \brief Number of messages dropped because the ring was full.
+	static std::size_t getNumDropped();
+
+	/// \brief Interned module names. Id 0 is the empty module.
+	static std::uint16_t getModuleId(const std::string & module);
+	static std::string getModuleName(std::uint16_t moduleId);
+	static std::size_t getNumModules();
 
 	/// \brief Destroy the console logger channel.
 	virtual ~LoggerChannel(){};
 	void log( ofLogLevel level, const std::string & module, const std::string & message );
 	void log( ofLogLevel level, const std::string & module, const char* format, ... ) OF_PRINTF_ATTR( 4, 5 );
 	void log( ofLogLevel level, const std::string & module, const char* format, va_list args );
+
+private:
+	struct Record {
+		double time;
+		std::int32_t level;
+		std::uint16_t moduleId;
+		std::uint16_t messageLength;
+		char* overflow; // Whole message when longer than MessageSize (null terminated), nullptr otherwise
+		char message[MessageSize];
+	};
+
+	struct alignas(64) Slot {
+		std::atomic<std::size_t> sequence;
+		Record record;
+	};
+
+	// Bounded multi-producer queue (Vyukov), single consumer (drain)
+	struct Ring {
+		explicit Ring(std::size_t capacity);
+		~Ring(); // Frees the overflow of the pending records
+		Record* beginPush(std::size_t& pos);
+		void endPush(std::size_t pos);
+		const Record* beginPop();
+		void endPop();
+
+		std::unique_ptr<Slot[]> slots;
+		std::size_t mask;
+		alignas(64) std::atomic<std::size_t> enqueuePos;
+		alignas(64) std::size_t dequeuePos;
+	};
+
+	static Ring & getRing();
+	static std::unique_ptr<Ring> & getRingPtr();
+	static void pushRecord( ofLogLevel level, const std::string & module, const char* format, va_list args );
 };
 
 } // end namespace ofxImGui
 
-#endif // IM_GUI_LOGGER_CHANNEL
\ No newline at end of file
+#endif // IM_GUI_LOGGER_CHANNEL